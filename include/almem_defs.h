@@ -1,4 +1,4 @@
-/* Copyright (C) 2023-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2023-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -48,6 +48,17 @@
 #define likely(x)      __builtin_expect(!!(x), 1)
 #define unlikely(x)    __builtin_expect(!!(x), 0)
 
+// Lets the compiler prune the code paths for which 'x' does not hold
+#define ALM_ASSUME(x)  do { if (!(x)) __builtin_unreachable(); } while (0)
+
+/* Size classes of the size class dispatching:
+ * small < 64B <= medium < 512B <= large
+ */
+#define SC_SMALL_SZ_LOG2        6
+#define SC_MEDIUM_SZ_LOG2       9
+#define SC_SMALL_MAX_SZ         (1UL << SC_SMALL_SZ_LOG2)
+#define SC_MEDIUM_MAX_SZ        (1UL << SC_MEDIUM_SZ_LOG2)
+
 #define __ALMEM_CONCAT2(x,y)    x##_##y
 #define __ALMEM_CONCAT(x,y)     __ALMEM_CONCAT2(x,y)
 
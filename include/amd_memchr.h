@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -43,6 +43,26 @@ HIDDEN_SYMBOL extern void * __memchr_zen5(const void *, int, size_t);
 //System solution which takes in system config and  threshold values.
 HIDDEN_SYMBOL extern void * __memchr_system(const void *, int, size_t);
 
+#ifdef ALMEM_TUNABLES
+//CPU Feature:AVX2 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern void *__memchr_avx2_unaligned(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_aligned(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_aligned_load(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_aligned_store(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_nt(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_nt_load(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx2_nt_store(const void *mem, int val, size_t size);
+
+//CPU Feature:AVX512 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern void *__memchr_avx512_unaligned(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_aligned(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_aligned_load(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_aligned_store(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_nt(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_nt_load(const void *mem, int val, size_t size);
+HIDDEN_SYMBOL extern void *__memchr_avx512_nt_store(const void *mem, int val, size_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -44,6 +44,23 @@ HIDDEN_SYMBOL extern void * __memcpy_zen5(void *dest,const void *src, size_t siz
 HIDDEN_SYMBOL extern void * __memcpy_system(void *dest,const void *src, size_t size);
 
 #ifdef ALMEM_TUNABLES
+//Size class specific implementations of the micro architecture variants.
+HIDDEN_SYMBOL extern void * __memcpy_zen1_small(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen1_medium(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen1_large(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen2_small(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen2_medium(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen2_large(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen3_small(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen3_medium(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen3_large(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen4_small(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen4_medium(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen4_large(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen5_small(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen5_medium(void *dest,const void *src, size_t size);
+HIDDEN_SYMBOL extern void * __memcpy_zen5_large(void *dest,const void *src, size_t size);
+
 //Generic solution which takes in user threshold values.
 HIDDEN_SYMBOL extern void * __memcpy_threshold(void *dest,const void *src, size_t size);
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -42,6 +42,26 @@ HIDDEN_SYMBOL extern char * __strchr_zen5(const char *, int);
 //System solution which takes in system config.
 HIDDEN_SYMBOL extern char * __strchr_system(const char *, int);
 
+#ifdef ALMEM_TUNABLES
+//CPU Feature:AVX2 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strchr_avx2_unaligned(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_aligned(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_aligned_load(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_aligned_store(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_nt(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_nt_load(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx2_nt_store(const char *str, int val);
+
+//CPU Feature:AVX512 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strchr_avx512_unaligned(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_aligned(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_aligned_load(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_aligned_store(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_nt(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_nt_load(const char *str, int val);
+HIDDEN_SYMBOL extern char *__strchr_avx512_nt_store(const char *str, int val);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -43,6 +43,26 @@ HIDDEN_SYMBOL extern char * __strcpy_zen5(char *,const char *);
 //System solution which takes in system config.
 HIDDEN_SYMBOL extern char * __strcpy_system(char *,const char *);
 
+#ifdef ALMEM_TUNABLES
+//CPU Feature:AVX2 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strcpy_avx2_unaligned(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_aligned(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_aligned_load(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_aligned_store(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_nt(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_nt_load(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx2_nt_store(char *dst, const char *src);
+
+//CPU Feature:AVX512 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strcpy_avx512_unaligned(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_aligned(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_aligned_load(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_aligned_store(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_nt(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_nt_load(char *dst, const char *src);
+HIDDEN_SYMBOL extern char *__strcpy_avx512_nt_store(char *dst, const char *src);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
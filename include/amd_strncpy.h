@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -43,6 +43,26 @@ HIDDEN_SYMBOL extern char * __strncpy_zen5(char *,const char *, size_t);
 //System solution which takes in system config and  threshold values.
 HIDDEN_SYMBOL extern char * __strncpy_system(char *,const char *, size_t);
 
+#ifdef ALMEM_TUNABLES
+//CPU Feature:AVX2 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strncpy_avx2_unaligned(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_aligned(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_aligned_load(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_aligned_store(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_nt(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_nt_load(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx2_nt_store(char *dst, const char *src, size_t size);
+
+//CPU Feature:AVX512 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern char *__strncpy_avx512_unaligned(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_aligned(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_aligned_load(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_aligned_store(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_nt(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_nt_load(char *dst, const char *src, size_t size);
+HIDDEN_SYMBOL extern char *__strncpy_avx512_nt_store(char *dst, const char *src, size_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,26 @@ HIDDEN_SYMBOL extern size_t __strnlen_zen5(const char *, size_t);
 //System solution which takes in system config.
 HIDDEN_SYMBOL extern size_t __strnlen_system(const char *, size_t);
 
+#ifdef ALMEM_TUNABLES
+//CPU Feature:AVX2 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_unaligned(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_aligned(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_aligned_load(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_aligned_store(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_nt(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_nt_load(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx2_nt_store(const char *str, size_t size);
+
+//CPU Feature:AVX512 and Alignment specifc implementations.
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_unaligned(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_aligned(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_aligned_load(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_aligned_store(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_nt(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_nt_load(const char *str, size_t size);
+HIDDEN_SYMBOL extern size_t __strnlen_avx512_nt_store(const char *str, size_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -26,31 +26,33 @@
 #define _LIBMEM_H_
 
 #include "almem_defs.h"
+#include "libmem_api.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef enum{
-    MEMCPY,
-    MEMPCPY,
-    MEMMOVE,
-    MEMSET,
-    MEMCMP, //end of Tunable supported funcs
-    MEMCHR,
-    STRCPY,
-    STRNCPY,
-    STRCMP,
-    STRNCMP,
-    STRCAT,
-    STRNCAT,
-    STRSTR,
-    STRLEN,
-    STRNLEN,
-    STRCHR,
-    STRSPN,
-    FUNC_COUNT,
-    TUN_FUNC_COUNT = MEMCMP + 1
+    MEMCPY = LIBMEM_MEMCPY,
+    MEMPCPY = LIBMEM_MEMPCPY,
+    MEMMOVE = LIBMEM_MEMMOVE,
+    MEMSET = LIBMEM_MEMSET, //end of Size class dispatched funcs
+    MEMCMP = LIBMEM_MEMCMP,
+    MEMCHR = LIBMEM_MEMCHR,
+    STRCPY = LIBMEM_STRCPY,
+    STRNCPY = LIBMEM_STRNCPY,
+    STRCMP = LIBMEM_STRCMP,
+    STRNCMP = LIBMEM_STRNCMP,
+    STRCAT = LIBMEM_STRCAT,
+    STRNCAT = LIBMEM_STRNCAT,
+    STRSTR = LIBMEM_STRSTR,
+    STRLEN = LIBMEM_STRLEN,
+    STRNLEN = LIBMEM_STRNLEN,
+    STRCHR = LIBMEM_STRCHR,
+    STRSPN = LIBMEM_STRSPN,
+    FUNC_COUNT = LIBMEM_FUNC_COUNT,
+    TUN_FUNC_COUNT = FUNC_COUNT,
+    SC_FUNC_COUNT = MEMSET + 1
 }func_index;
 
 #ifdef ALMEM_TUNABLES
@@ -135,6 +137,47 @@ typedef void (*func_ptr)(void);
         generate_threshold_variant(func) \
     }
 
+/* String functions have no ERMS or threshold variants: the NULL columns keep
+ * the CPU dispatched implementation.
+ */
+#define generate_str_na_variants \
+    NULL, NULL, NULL, NULL, NULL
+
+#define add_tun_str_variants(func) \
+    { \
+        generate_avx2_variants(func) \
+        generate_avx512_variants(func) \
+        generate_str_na_variants \
+    }
+
+#define generate_arch_isa_variants(func, arch) \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), \
+    (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), arch),
+
+// Compare and search functions: the zen3 AVX2 and zen4 AVX512 kernels for every operation
+#define add_tun_str_arch_variants(func) \
+    { \
+        generate_arch_isa_variants(func, zen3) \
+        generate_arch_isa_variants(func, zen4) \
+        generate_str_na_variants \
+    }
+
+// Tunable variant names, in the order of tunable_variant_idx
+HIDDEN_SYMBOL const char * const libmem_tun_variant_names[TUN_VARIANT_COUNT] =
+{
+    "avx2_unaligned", "avx2_aligned", "avx2_aligned_load", "avx2_aligned_store",
+    "avx2_nt", "avx2_nt_load", "avx2_nt_store",
+    "avx512_unaligned", "avx512_aligned", "avx512_aligned_load", "avx512_aligned_store",
+    "avx512_nt", "avx512_nt_load", "avx512_nt_store",
+    "erms_b_aligned", "erms_w_aligned", "erms_d_aligned", "erms_q_aligned",
+    "threshold"
+};
+
 // Tunable Dispatching Table
 HIDDEN_SYMBOL func_ptr libmem_tun_impls[TUN_FUNC_COUNT][TUN_VARIANT_COUNT] =
 {
@@ -142,7 +185,19 @@ HIDDEN_SYMBOL func_ptr libmem_tun_impls[TUN_FUNC_COUNT][TUN_VARIANT_COUNT] =
     add_tun_func_variants(mempcpy),
     add_tun_func_variants(memmove),
     add_tun_func_variants(memset),
-    add_tun_func_variants(memcmp)
+    add_tun_func_variants(memcmp),
+    add_tun_str_variants(memchr),
+    add_tun_str_variants(strcpy),
+    add_tun_str_variants(strncpy),
+    add_tun_str_arch_variants(strcmp),
+    add_tun_str_arch_variants(strncmp),
+    add_tun_str_variants(strcat),
+    add_tun_str_variants(strncat),
+    add_tun_str_arch_variants(strstr),
+    add_tun_str_variants(strlen),
+    add_tun_str_variants(strnlen),
+    add_tun_str_variants(strchr),
+    add_tun_str_arch_variants(strspn),
 };
 
 
@@ -165,6 +220,12 @@ HIDDEN_SYMBOL func_ptr libmem_tun_impls[TUN_FUNC_COUNT][TUN_VARIANT_COUNT] =
     }
 
 
+// CPU variant names, in the order of cpu_variant_idx
+HIDDEN_SYMBOL const char * const libmem_cpu_variant_names[CPU_VARIANT_COUNT] =
+{
+    "zen1", "zen2", "zen3", "zen4", "zen5", "system"
+};
+
 // CPU Dispatching Table
 HIDDEN_SYMBOL func_ptr libmem_cpu_impls[FUNC_COUNT][CPU_VARIANT_COUNT] =
 {
@@ -187,6 +248,48 @@ HIDDEN_SYMBOL func_ptr libmem_cpu_impls[FUNC_COUNT][CPU_VARIANT_COUNT] =
     add_cpu_func_variants(strspn),
 };
 
+#ifdef ALMEM_TUNABLES
+typedef enum{
+    SC_SMALL,   // size < SC_SMALL_MAX_SZ
+    SC_MEDIUM,  // size < SC_MEDIUM_MAX_SZ
+    SC_LARGE,
+    SIZE_CLASS_COUNT
+} size_class_idx;
+
+#define generate_arch_sc_variants(func, arch) \
+    { \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), small), \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), medium), \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_CONCAT(__ALMEM_PREFIX(func), arch), large), \
+    },
+
+#define generate_system_sc_variant(func) \
+    { \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), system), \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), system), \
+        (func_ptr) __ALMEM_CONCAT(__ALMEM_PREFIX(func), system), \
+    }
+
+#define add_sc_func_variants(func) \
+    { \
+        generate_arch_sc_variants(func, zen1) \
+        generate_arch_sc_variants(func, zen2) \
+        generate_arch_sc_variants(func, zen3) \
+        generate_arch_sc_variants(func, zen4) \
+        generate_arch_sc_variants(func, zen5) \
+        generate_system_sc_variant(func) \
+    }
+
+// Size Class Dispatching Table
+HIDDEN_SYMBOL func_ptr libmem_sc_impls[SC_FUNC_COUNT][CPU_VARIANT_COUNT][SIZE_CLASS_COUNT] =
+{
+    add_sc_func_variants(memcpy),
+    add_sc_func_variants(mempcpy),
+    add_sc_func_variants(memmove),
+    add_sc_func_variants(memset),
+};
+#endif //end of size class variants
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,190 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _LIBMEM_API_H_
+#define _LIBMEM_API_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Functions supported by the library
+typedef enum {
+    LIBMEM_MEMCPY,
+    LIBMEM_MEMPCPY,
+    LIBMEM_MEMMOVE,
+    LIBMEM_MEMSET,
+    LIBMEM_MEMCMP,
+    LIBMEM_MEMCHR,
+    LIBMEM_STRCPY,
+    LIBMEM_STRNCPY,
+    LIBMEM_STRCMP,
+    LIBMEM_STRNCMP,
+    LIBMEM_STRCAT,
+    LIBMEM_STRNCAT,
+    LIBMEM_STRSTR,
+    LIBMEM_STRLEN,
+    LIBMEM_STRNLEN,
+    LIBMEM_STRCHR,
+    LIBMEM_STRSPN,
+    LIBMEM_FUNC_COUNT
+} libmem_func;
+
+typedef struct {
+    const char *func;       // function name, e.g. "memcpy"
+    const char *variant;    // implementation the calls are dispatched to, e.g. "zen4"
+} libmem_func_info;
+
+typedef struct {
+    const char *uarch;                  // cpu variant selected by the library, e.g. "zen5"
+    uint64_t l1d_size;                  // L1 data cache per core in Bytes
+    uint64_t l2_size;                   // L2 cache per core in Bytes
+    uint64_t l3_size;                   // L3 cache per CCX in Bytes
+    uint64_t repmov_start_threshold;
+    uint64_t repmov_stop_threshold;
+    uint64_t repstore_start_threshold;
+    uint64_t repstore_stop_threshold;
+    uint64_t nt_start_threshold;
+    uint64_t nt_stop_threshold;
+    libmem_func_info funcs[LIBMEM_FUNC_COUNT];
+} libmem_runtime_info;
+
+typedef struct {
+    uint64_t repmov_start_threshold;
+    uint64_t repmov_stop_threshold;
+    uint64_t repstore_start_threshold;
+    uint64_t repstore_stop_threshold;
+    uint64_t nt_start_threshold;
+    uint64_t nt_stop_threshold;
+} libmem_thresholds;
+
+/* Reports the cpu variant, cache sizes, thresholds and the implementation
+ * each function is dispatched to, as configured by the library at load time.
+ * returns: 0 on success, -1 if info is NULL
+ */
+extern int libmem_get_runtime_info(libmem_runtime_info *info);
+
+/* Rebinds the function to a variant of the dispatching tables: a cpu variant
+ * ("zen1".."zen5", "system") or, for memcpy/mempcpy/memmove/memset/memcmp,
+ * a tunable variant such as "avx512_nt" or "erms_b_aligned".
+ * Safe to call while other threads use the function: calls in flight finish
+ * on the previous implementation. Available only with tunables builds.
+ * returns: 0 on success, -1 on unknown function/variant, variant not
+ *          supported by the cpu, function bound by LIBMEM_DIRECT_BIND or
+ *          non-tunables builds
+ */
+extern int libmem_set_variant(libmem_func func, const char *variant);
+
+/* Replaces the repmov, repstore and non-temporal thresholds in Bytes, on
+ * every core class of mixed classic/dense core systems. The repmov and
+ * non-temporal thresholds apply to memcpy and memmove alike, the
+ * non-temporal ones to the memset non-temporal stores as well.
+ * Each threshold is updated atomically, a call racing with the update may
+ * still observe a mix of the previous and the new boundaries.
+ * returns: 0 on success, -1 if thresholds is NULL or a start exceeds its stop
+ */
+extern int libmem_set_thresholds(const libmem_thresholds *thresholds);
+
+/* Re-reads the config file and the LIBMEM_* environment variables and applies
+ * the operation, thresholds and per-function variants they set, as at load
+ * time. Every threshold and dispatching entry is published with a single
+ * atomic store: calls in flight finish on either the previous or the new
+ * value, a call racing with the reload may combine previous and new values.
+ * Settings of the cache topology (LIBMEM_L3_SHARING, LIBMEM_SYSFS_ROOT,
+ * LIBMEM_CALIBRATE) keep their load time values, LIBMEM_ADAPTIVE stops.
+ * Functions bound by LIBMEM_DIRECT_BIND keep their kernels, only the
+ * thresholds are reloaded for them.
+ * Available only with tunables builds.
+ * returns: 0 on success, -1 on non-tunables builds
+ */
+extern int libmem_reload(void);
+
+/* Writes the report of the A/B experiment set by LIBMEM_EXPERIMENT to the
+ * file descriptor: per size bucket, the calls and mean cycles of the
+ * baseline and candidate variants with their 95% confidence intervals, and
+ * the change of the candidate over the baseline. Also written to stderr at
+ * exit. Available only with tunables builds.
+ * returns: 0 on success, -1 without experiment, on write failure or
+ *          non-tunables builds
+ */
+extern int libmem_experiment_report(int fd);
+
+/* Writes, per function, the calls checked against the system implementation
+ * by the LIBMEM_CANARY verification and the divergences found to the file
+ * descriptor. Also written to stderr at exit. Available only with tunables
+ * builds.
+ * returns: 0 on success, -1 without verification, on write failure or
+ *          non-tunables builds
+ */
+extern int libmem_canary_report(int fd);
+
+/* Call statistics of LIBMEM_STATS, counted per thread. With LIBMEM_STATS=shm
+ * they are exported live in /dev/shm/libmem-<pid>: a libmem_stats_header
+ * followed by thread_max libmem_stats_thread slots, each thread counting into
+ * its own slot. Readers map the file and sum the slots of the threads.
+ */
+#define LIBMEM_STATS_MAGIC          0x31534d454d42494cULL   //"LIBMEMS1"
+#define LIBMEM_STATS_VERSION        1
+#define LIBMEM_STATS_SIZE_BUCKETS   64      //bucket b: sizes [2^b, 2^(b+1)), 0 in bucket 0
+#define LIBMEM_STATS_ALIGN_BUCKETS  64      //offset of the buffer in its 64B cache line
+#define LIBMEM_STATS_THREADS        1024
+
+typedef struct {
+    // calls with a known size: the size argument, the length returned by
+    // strlen/strnlen/strspn or the offset of the match of strchr/strstr
+    uint64_t size[LIBMEM_STATS_SIZE_BUCKETS];
+    // every call: the first pointer argument (destination, or the first
+    // buffer/string), the second one if any
+    uint64_t dst_align[LIBMEM_STATS_ALIGN_BUCKETS];
+    uint64_t src_align[LIBMEM_STATS_ALIGN_BUCKETS];
+} libmem_stats_func;
+
+typedef struct {
+    libmem_stats_func funcs[LIBMEM_FUNC_COUNT];
+} __attribute__((aligned(64))) libmem_stats_thread;
+
+typedef struct {
+    uint64_t magic;                 // LIBMEM_STATS_MAGIC
+    uint32_t version;               // LIBMEM_STATS_VERSION
+    uint32_t pid;
+    uint32_t thread_max;            // slots following the header
+    uint32_t threads;               // threads counting, those beyond thread_max share the last slot
+} __attribute__((aligned(64))) libmem_stats_header;
+
+/* Writes the calls of every function counted by LIBMEM_STATS to the file
+ * descriptor, summed over the threads: the calls per power of two size and
+ * per alignment of the buffers. Also written to stderr at exit with
+ * LIBMEM_STATS=1. Available only with tunables builds.
+ * returns: 0 on success, -1 without statistics, on write failure or
+ *          non-tunables builds
+ */
+extern int libmem_stats_report(int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -45,6 +45,28 @@
         );
 
 
+#define G_SC_ENTRY_PT_ASM(fn) _##fn##_sc_variants
+
+// log2(size) buckets of the size class dispatching tables
+#define SC_BUCKET_COUNT     64
+
+/* Size class mapping for the functions taking the size as third argument:
+ * jumps through the log2(size) bucket of the function's dispatching table.
+ */
+#define LIBMEM_SC_FN_MAP(fn)                     \
+    asm (                               \
+    "\n\t"".p2align 4"                      \
+    "\n\t"".global " MK_FN_NAME(fn)                  \
+    "\n\t"".type " STRINGIFY(FN_PROTOTYPE(fn)) " ,@function"    \
+    "\n\t" MK_FN_NAME(fn) " :"                  \
+    "\n\t" "mov %rdx, %rax"                    \
+    "\n\t" "or $1, %rax"                       \
+    "\n\t" "bsr %rax, %rax"                    \
+    "\n\t" "mov " STRINGIFY(G_SC_ENTRY_PT_ASM(fn)) "@GOTPCREL(%rip), %r11" \
+    "\n\t" "jmp *(%r11, %rax, 8)"              \
+        );
+
+
 #define WEAK_ALIAS(x, y)                                   \
         asm("\n\t"".weak " STRINGIFY(x)                         \
             "\n\t"".set " STRINGIFY(x) ", " STRINGIFY(y)        \
@@ -0,0 +1,73 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _SYSTEM_IMPLS_H_
+#define _SYSTEM_IMPLS_H_
+
+#include "libmem_impls.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Glibc implementations backing the __<func>_system variants.
+ * Resolved once from LIBC_SO and never modified afterwards.
+ */
+typedef struct {
+    amd_memcpy_fn   memcpy_fn;
+    amd_mempcpy_fn  mempcpy_fn;
+    amd_memmove_fn  memmove_fn;
+    amd_memset_fn   memset_fn;
+    amd_memcmp_fn   memcmp_fn;
+    amd_memchr_fn   memchr_fn;
+    amd_strcpy_fn   strcpy_fn;
+    amd_strncpy_fn  strncpy_fn;
+    amd_strcmp_fn   strcmp_fn;
+    amd_strncmp_fn  strncmp_fn;
+    amd_strcat_fn   strcat_fn;
+    amd_strncat_fn  strncat_fn;
+    amd_strstr_fn   strstr_fn;
+    amd_strlen_fn   strlen_fn;
+    amd_strnlen_fn  strnlen_fn;
+    amd_strchr_fn   strchr_fn;
+    amd_strspn_fn   strspn_fn;
+} system_impls;
+
+HIDDEN_SYMBOL extern system_impls __system_impls;
+
+HIDDEN_SYMBOL extern void __system_impls_init(void);
+
+/* Resolves the table on first use for calls issued before libmem_init(),
+ * e.g. from constructors of libraries initialized ahead of libmem.
+ */
+#define SYSTEM_IMPL(fn)                                         \
+    (unlikely(__system_impls.fn##_fn == NULL) ?                 \
+        (__system_impls_init(), __system_impls.fn##_fn) :       \
+        __system_impls.fn##_fn)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -41,6 +41,20 @@
  *   NT stores - non-temporal store-only  (memset)
  */
 
+/*
+ * L3 share of a thread = L3 per CCX / threads sharing it.
+ * NT thresholds are computed on the share: a thread copying its whole
+ * CCX L3 evicts the working sets of the other threads on the CCX.
+ */
+#define COMPUTE_L3_SHARE(l3_bytes, threads) ((l3_bytes) / (threads))
+
+/*
+ * NT moves never start below L2 per core: smaller copies are served from
+ * the private L2 without polluting the shared L3.
+ */
+#define CLAMP_NT_THRESHOLD(nt_bytes, l2_bytes) \
+    ((nt_bytes) < (l2_bytes) ? (l2_bytes) : (nt_bytes))
+
 /*
  * Pre-Zen5 non-temporal moves threshold = 3/4 of L3 cache.
  * Above this size, memcpy/memmove switch to NT moves.
@@ -54,6 +68,13 @@
  */
 #define COMPUTE_NT_THRESHOLD_ZEN5(l3_bytes) (l3_bytes)
 
+/*
+ * rep-movs start threshold of non-AMD CPUs = 2KB per 16B of vector width:
+ * wider vector loops keep up with rep-movs for longer. With FSRM, rep-movs
+ * starts at 2KB whatever the vector width.
+ */
+#define COMPUTE_REPMOV_START_TH(vec_bytes) (((vec_bytes) / XMM_SZ) * 2048)
+
 /*
  * Zen5 aligned vector move threshold = L1D/2 + 2KB.
  * Below this size, memcpy/memmove use aligned vector loads+stores.
@@ -72,13 +93,77 @@
 extern "C" {
 #endif
 
-/* Instruction-specific thresholds */
+/* Instruction-specific thresholds, in blocks read by the kernels of a function:
+ *   memcpy, mempcpy, memcmp - repmov and nt
+ *   memmove                 - memmove repmov and nt
+ *   memset                  - repstore and nt store
+ */
 extern uint64_t __repmov_start_threshold;
 extern uint64_t __repmov_stop_threshold;
 extern uint64_t __repstore_start_threshold;
 extern uint64_t __repstore_stop_threshold;
 extern uint64_t __nt_start_threshold;
 extern uint64_t __nt_stop_threshold;
+extern uint64_t __memmove_repmov_start_threshold;
+extern uint64_t __memmove_repmov_stop_threshold;
+extern uint64_t __memmove_nt_start_threshold;
+extern uint64_t __memmove_nt_stop_threshold;
+extern uint64_t __nt_store_start_threshold;
+extern uint64_t __nt_store_stop_threshold;
+
+/*
+ * Core classes: groups of CPUs with the same L3 per CCX and threads sharing
+ * it, e.g. the classic and dense (Zen4c/Zen5c) cores of one part that share
+ * the CPUID family/model. With more than one class, the L3 sized thresholds
+ * are looked up per call from the class of the CPU the thread runs on.
+ */
+#define CORE_CLASS_MAX      4
+#define CORE_CLASS_CPU_MAX  4096    //CPU number field of TSC_AUX
+
+typedef struct {
+    uint64_t nt_start_threshold;
+    uint64_t repstore_stop_threshold;
+} core_class_thresholds;
+
+extern uint32_t __core_class_count;
+extern uint8_t __cpu_core_class[CORE_CLASS_CPU_MAX];
+extern core_class_thresholds __core_class_thresholds[CORE_CLASS_MAX];
+
+/* Class of the CPU the thread runs on: Linux keeps the CPU number in the low
+ * 12 bits of TSC_AUX, RDPID reads it without serializing like RDTSCP does.
+ * The per-CPU table stays valid across migrations, no per-thread state to refresh.
+ */
+static inline const core_class_thresholds *__core_class_cur(void)
+{
+    uint64_t tsc_aux;
+
+    asm volatile ("rdpid %0" : "=r"(tsc_aux));
+    return &__core_class_thresholds[__cpu_core_class[tsc_aux & (CORE_CLASS_CPU_MAX - 1)]];
+}
+
+/* Non-temporal start threshold of the core the thread runs on */
+static inline uint64_t __nt_start_threshold_cur(void)
+{
+    if (__builtin_expect(__core_class_count <= 1, 1))
+        return __nt_start_threshold;
+    return __core_class_cur()->nt_start_threshold;
+}
+
+/* memmove non-temporal start threshold of the core the thread runs on */
+static inline uint64_t __memmove_nt_start_threshold_cur(void)
+{
+    if (__builtin_expect(__core_class_count <= 1, 1))
+        return __memmove_nt_start_threshold;
+    return __core_class_cur()->nt_start_threshold;
+}
+
+/* rep-stores stop threshold of the core the thread runs on */
+static inline uint64_t __repstore_stop_threshold_cur(void)
+{
+    if (__builtin_expect(__core_class_count <= 1, 1))
+        return __repstore_stop_threshold;
+    return __core_class_cur()->repstore_stop_threshold;
+}
 
 #ifdef __cplusplus
 }
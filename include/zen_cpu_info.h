@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -73,6 +73,43 @@ uint64_t nt_stop_threshold;
 #define     RDPID_MASK      (1 << 22)
 #define     VPCLMULQDQ_MASK (1 << 10)
 #define     MOVDIRI_MASK    (1 << 27)
+#define     BMI2_MASK       (1 <<  8)
+#define     AVX512BW_MASK   (1 << 30)
+#define     AVX512VL_MASK   (1U << 31)
+#define     AVX512VBMI_MASK (1 <<  1)
+
+/* AVX512 subsets the zen4/zen5 kernels are built with: F, BW, VL (EBX) and VBMI (ECX) */
+#define AVX512_KERNEL_EBX_MASK  (AVX512_MASK | AVX512BW_MASK | AVX512VL_MASK)
+#define AVX512_KERNEL_ECX_MASK  AVX512VBMI_MASK
+
+/* CPUID 0 vendor signature in EBX, EDX, ECX */
+#define AMD_VENDOR_EBX      0x68747541  //"Auth"
+#define AMD_VENDOR_EDX      0x69746E65  //"enti"
+#define AMD_VENDOR_ECX      0x444D4163  //"cAMD"
+#define HYGON_VENDOR_EBX    0x6F677948  //"Hygo"
+#define HYGON_VENDOR_EDX    0x6E65476E  //"nGen"
+#define HYGON_VENDOR_ECX    0x656E6975  //"uine"
+#define INTEL_VENDOR_EBX    0x756E6547  //"Genu"
+#define INTEL_VENDOR_EDX    0x49656E69  //"ineI"
+#define INTEL_VENDOR_ECX    0x6C65746E  //"ntel"
+
+/* Deterministic cache parameters: CPUID 0x8000001D on AMD/Hygon, CPUID 0x4 on others */
+#define AMD_CACHE_LEAF      0x8000001D
+#define X86_CACHE_LEAF      0x4
+#define CACHE_LEAF_MAX_SUBLEAF  16
+
+#define CACHE_TYPE(eax)     ((eax) & 0x1f)          //0: no more caches, 1: data, 2: instruction, 3: unified
+#define CACHE_LEVEL(eax)    (((eax) >> 5) & 0x7)
+#define CACHE_TYPE_NULL     0
+#define CACHE_TYPE_INSTR    2
+/* Cache size: ways * partitions * line size * sets */
+#define CACHE_SIZE(ebx, ecx) ((uint64_t)((((ebx) >> 22) & 0x3ff) + 1) * ((((ebx) >> 12) & 0x3ff) + 1) \
+                                * (((ebx) & 0xfff) + 1) * ((ecx) + 1))
+
+/* Logical processors sharing a cache: EAX[25:14] + 1.
+ * CPUID 0x4 reports the IDs reserved for the sharing threads, an upper bound of their count.
+ */
+#define CACHE_SHARING_THREADS(eax)  ((((eax) >> 14) & 0xfff) + 1)
 
 
 #define ZEN1_L3 8*1024*1024     //8MB per CCX
@@ -89,12 +126,92 @@ uint64_t nt_stop_threshold;
 
 typedef enum
 {
+    OTHER_VENDOR = 0,
+    AMD_VENDOR,
+    HYGON_VENDOR,      //Zen1 based, CPUID compatible with AMD
+    INTEL_VENDOR
+} cpu_vendor;
+
+typedef enum
+{
+    UARCH_UNKNOWN = 0,
     ZEN1,
     ZEN2,
     ZEN3,
-    ZEN4
+    ZEN4,
+    ZEN5
 } microarch;
 
+/* CPUID 1 EAX: family and model, extended by their EAX[27:20] and EAX[19:16] fields */
+#define CPUID_FAMILY(eax)   ((((eax) >> 8) & 0xf) + ((((eax) >> 8) & 0xf) == 0xf ? (((eax) >> 20) & 0xff) : 0))
+#define CPUID_MODEL(eax)    ((((eax) >> 4) & 0xf) | ((((eax) >> 8) & 0xf) == 0xf ? (((eax) >> 12) & 0xf0) : 0))
+
+#define ZEN5_FAMILY         0x1A    //latest family of the model table
+
+/* Zen generation of an AMD or Hygon family and model
+ * returns: microarch, UARCH_UNKNOWN for models outside the table
+ */
+static inline microarch zen_uarch_from_model(uint32_t family, uint32_t model)
+{
+    static const struct {
+        uint8_t family;
+        uint8_t model_lo;
+        uint8_t model_hi;
+        uint8_t uarch;
+    } zen_models[] = {
+        {0x17, 0x00, 0x2F, ZEN1},   //Zen, Zen+
+        {0x17, 0x30, 0xFF, ZEN2},   //Rome, Renoir, Matisse, Van Gogh, Mendocino
+        {0x18, 0x00, 0xFF, ZEN1},   //Hygon Dhyana
+        {0x19, 0x00, 0x0F, ZEN3},   //Milan
+        {0x19, 0x10, 0x1F, ZEN4},   //Genoa, Bergamo
+        {0x19, 0x20, 0x5F, ZEN3},   //Vermeer, Rembrandt, Cezanne
+        {0x19, 0x60, 0x7F, ZEN4},   //Raphael, Phoenix
+        {0x19, 0xA0, 0xAF, ZEN4},   //Bergamo, Siena
+        {0x1A, 0x00, 0xFF, ZEN5},   //Turin, Granite Ridge, Strix
+    };
+
+    for (unsigned int idx = 0; idx < sizeof(zen_models) / sizeof(zen_models[0]); idx++)
+    {
+        if (family == zen_models[idx].family && model >= zen_models[idx].model_lo &&
+                model <= zen_models[idx].model_hi)
+            return (microarch)zen_models[idx].uarch;
+    }
+    return UARCH_UNKNOWN;
+}
+
+/* Zen generation guessed from the CPUID 7 feature bits, for models outside the table
+ * returns: microarch, UARCH_UNKNOWN without AVX2
+ */
+static inline microarch zen_uarch_from_features(uint32_t ebx, uint32_t ecx)
+{
+    if (ebx & AVX512_MASK)
+        return (ecx & MOVDIRI_MASK) ? ZEN5 : ZEN4;
+    if (ebx & AVX2_MASK)
+    {
+        if (ecx & VPCLMULQDQ_MASK)
+            return ZEN3;
+        if (ecx & RDPID_MASK)
+            return ZEN2;
+        if (ebx & RDSEED_MASK)
+            return ZEN1;
+    }
+    return UARCH_UNKNOWN;
+}
+
+/* Lowers a Zen generation to the kernels the exposed ISA can run: hypervisors
+ * may hide AVX512 from a Zen4/Zen5 guest
+ * returns: microarch, UARCH_UNKNOWN without AVX2
+ */
+static inline microarch zen_uarch_supported(microarch uarch, uint32_t ebx, uint32_t ecx)
+{
+    if (uarch >= ZEN4 && !(((ebx & AVX512_KERNEL_EBX_MASK) == AVX512_KERNEL_EBX_MASK) &&
+                            (ecx & AVX512_KERNEL_ECX_MASK)))
+        uarch = ZEN3;
+    if (!((ebx & AVX2_MASK) && (ebx & BMI2_MASK)))
+        uarch = UARCH_UNKNOWN;
+    return uarch;
+}
+
 typedef struct {
     unsigned int threads_per_core;
     unsigned int threads_per_ccx;
@@ -119,8 +236,16 @@ bool erms;
 } cpu_operation;
 
 typedef struct {
+    uint64_t l3_per_ccx;        //L3 per CCX granted to the process by resctrl L3 CAT
+    unsigned int cpus;          //CPUs the process may run on: affinity and cgroup cpuset
+} cache_budget;
+
+typedef struct {
+    cpu_vendor vendor;
+    microarch zen_uarch;
     cpu_features zen_cpu_features;
     cache_info zen_cache_info;
+    cache_budget zen_cache_budget;
     thread_info zen_thread_info;
     thresholds zen_thresholds;
 } cpu_info;
@@ -137,11 +262,51 @@ typedef enum {
 }alignment;
 
 
+//L3 share the non-temporal threshold is derived from
+typedef enum {
+    CCX_SHARE = 0,      //L3 per CCX split across the threads sharing it
+    AFFINITY_SHARE,     //L3 per CCX split across the CPUs the process may run on
+    NO_SHARE            //whole L3 per CCX
+} l3_sharing;
+
+//Longest variant name of LIBMEM_EXPERIMENT, NUL included
+#define EXPERIMENT_VARIANT_SZ   32
+//Share of the calls on the candidate of LIBMEM_EXPERIMENT, in percent
+#define EXPERIMENT_DEFAULT_PERCENT  10
+
+//Threshold blocks of the user threshold config
+typedef enum {
+    TH_MEMCPY,      //LIBMEM_MEMCPY_THRESHOLD: memcpy, mempcpy and memcmp
+    TH_MEMMOVE,     //LIBMEM_MEMMOVE_THRESHOLD
+    TH_MEMSET,      //LIBMEM_MEMSET_THRESHOLD: rep-stores and non-temporal stores
+    TH_ALL,         //LIBMEM_THRESHOLD: default of the function blocks
+    TH_BLOCK_COUNT
+} threshold_block;
+
+// LIBMEM_STATS: call statistics reported at exit or exported live
+typedef enum{
+    STATS_OFF,
+    STATS_EXIT,     //written to stderr at exit
+    STATS_SHM       //exported in /dev/shm/libmem-<pid>
+} stats_mode;
+
 typedef struct{
     cpu_operation user_operation;
-    thresholds user_threshold;
+    thresholds user_threshold[TH_BLOCK_COUNT];
+    uint32_t user_threshold_blocks;     //bit per threshold block set by the user
     alignment src_aln;
     alignment dst_aln;
+    l3_sharing l3_share;
+    const char *sysfs_root;
+    bool calibrate;
+    const char *calib_file;
+    bool adaptive;
+    uint32_t experiment_func;                           //libmem_func of LIBMEM_EXPERIMENT
+    uint32_t experiment_percent;                        //share of the calls on the candidate
+    char experiment_variant[EXPERIMENT_VARIANT_SZ];     //candidate, empty without experiment
+    uint32_t canary_rate;                               //one in N calls checked, 0 for none
+    stats_mode stats;                                   //LIBMEM_STATS
+    bool direct_bind;                                   //functions bound by the IFUNC resolvers
 } user_cfg;
 
 typedef enum{
@@ -151,8 +316,31 @@ typedef enum{
     CHK_CFG
 } config;
 
+//Config file read when LIBMEM_CONFIG is not set
+#define LIBMEM_CONFIG_FILE  "/etc/libmem.conf"
+
+HIDDEN_SYMBOL void parse_config_file(const char *path);
+HIDDEN_SYMBOL const char *config_getenv(const char *name);
+
+HIDDEN_SYMBOL void parse_env_config_cfg(void);
 HIDDEN_SYMBOL void parse_env_operation_cfg(void);
 HIDDEN_SYMBOL void parse_env_threshold_cfg(void);
+HIDDEN_SYMBOL void parse_env_l3_sharing_cfg(void);
+HIDDEN_SYMBOL void parse_env_sysfs_root_cfg(void);
+HIDDEN_SYMBOL void parse_env_calibrate_cfg(void);
+HIDDEN_SYMBOL void parse_env_adaptive_cfg(void);
+HIDDEN_SYMBOL void parse_env_variant_cfg(const char **variants);
+HIDDEN_SYMBOL void parse_env_experiment_cfg(void);
+HIDDEN_SYMBOL void parse_env_canary_cfg(void);
+HIDDEN_SYMBOL void parse_env_stats_cfg(void);
+
+// Parsers of the values, free of libc for the IFUNC resolvers
+HIDDEN_SYMBOL int parse_operation_value(const char *value, cpu_operation *op,
+                                        alignment *src_aln, alignment *dst_aln);
+HIDDEN_SYMBOL int parse_threshold_block_value(const char *value, threshold_block blk,
+                                              thresholds *th);
+extern HIDDEN_SYMBOL const char * const threshold_envs[TH_BLOCK_COUNT];
+extern HIDDEN_SYMBOL const char * const variant_envs[];
 
 #ifdef __cplusplus
 }
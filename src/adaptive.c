@@ -0,0 +1,364 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <x86intrin.h>
+
+/*
+ * Adaptive thresholds (LIBMEM_ADAPTIVE=1): the memcpy and memset buckets of
+ * the dispatching tables around the thresholds are bound to sampling entries.
+ * One in ADAPTIVE_SAMPLE_RATE calls of a thread, at jittered intervals not to
+ * alias with periodic call patterns, runs on the vector, ERMS or NT
+ * implementation picked at random, timed with rdtsc into a per bucket
+ * average of cycles per byte. Every ADAPTIVE_UPDATE_RATE samples, each
+ * boundary steps towards the strategy that wins next to it by more than the
+ * hysteresis, within bounds of its configured value.
+ * No thread ever waits: a sample arriving while another thread updates the
+ * boundaries leaves them for the next round.
+ */
+
+#define ADAPTIVE_SAMPLE_RATE    4096                //1 in 4096 calls on average
+#define ADAPTIVE_UPDATE_RATE    64                  //samples between boundary updates
+#define ADAPTIVE_MIN_SAMPLES    8                   //per strategy in a bucket to compare
+#define ADAPTIVE_EWMA_SHIFT     3                   //weight 1/8 of a new sample
+#define ADAPTIVE_COST_SHIFT     8                   //fixed point of cycles per byte
+#define ADAPTIVE_HYST_SHIFT     3                   //winner has to be 1/8 faster
+#define ADAPTIVE_STEP_SHIFT     4                   //boundary moves by 1/16 per update
+#define ADAPTIVE_BOUND_SHIFT    2                   //within [1/4, 4x] of the configured value
+#define ADAPTIVE_BOUNDARY_MAX   5
+
+typedef enum {
+    ADAPTIVE_VEC,
+    ADAPTIVE_ERMS,
+    ADAPTIVE_NT,
+    ADAPTIVE_STRATEGY_COUNT
+} adaptive_strategy;
+
+typedef enum {
+    ADAPTIVE_MEMCPY,
+    ADAPTIVE_MEMSET,
+    ADAPTIVE_OP_COUNT
+} adaptive_op;
+
+typedef struct {
+    uint32_t cost;          //average cycles per byte, fixed point
+    uint32_t samples;
+} adaptive_stat;
+
+// Threshold between the strategy used below and the one used from it on
+typedef struct {
+    uint64_t *threshold;
+    uint64_t *floor;        //threshold the boundary stays above, if any
+    uint64_t *ceil;         //threshold the boundary stays below, if any
+    uint64_t lo;
+    uint64_t hi;
+    adaptive_op op;
+    adaptive_strategy below;
+    adaptive_strategy above;
+} adaptive_boundary;
+
+static bool adaptive_active;
+static uint64_t adaptive_samples;
+static size_t adaptive_min_bkt = SC_BUCKET_COUNT;
+static unsigned int adaptive_boundary_count;
+static adaptive_boundary adaptive_boundaries[ADAPTIVE_BOUNDARY_MAX];
+static func_ptr adaptive_strategies[ADAPTIVE_OP_COUNT][ADAPTIVE_STRATEGY_COUNT];
+static adaptive_stat adaptive_stats[ADAPTIVE_OP_COUNT][SC_BUCKET_COUNT][ADAPTIVE_STRATEGY_COUNT];
+
+// entries of the buckets bound to the sampling entries
+static amd_memcpy_fn adaptive_memcpy_impls[SC_BUCKET_COUNT];
+static amd_memset_fn adaptive_memset_impls[SC_BUCKET_COUNT];
+
+// calls of the thread left before its next sample, and its random state
+static __thread uint32_t adaptive_countdown __attribute__((tls_model("initial-exec")));
+static __thread uint32_t adaptive_seed __attribute__((tls_model("initial-exec")));
+
+/* Checks the strategy is faster than the other one in the bucket by more
+ * than the hysteresis, with enough samples of both
+ * returns: true if it wins
+ */
+static inline bool adaptive_wins(adaptive_op op, size_t bkt, adaptive_strategy strategy,
+                                 adaptive_strategy other)
+{
+    adaptive_stat *stats = adaptive_stats[op][bkt];
+    uint32_t cost = __atomic_load_n(&stats[strategy].cost, __ATOMIC_RELAXED);
+
+    if (__atomic_load_n(&stats[strategy].samples, __ATOMIC_RELAXED) < ADAPTIVE_MIN_SAMPLES
+        || __atomic_load_n(&stats[other].samples, __ATOMIC_RELAXED) < ADAPTIVE_MIN_SAMPLES)
+        return false;
+
+    return (uint64_t)cost + (cost >> ADAPTIVE_HYST_SHIFT) <
+                        __atomic_load_n(&stats[other].cost, __ATOMIC_RELAXED);
+}
+
+/* Steps the boundary down when the strategy above it wins in the bucket
+ * below it, up when the strategy below it wins in the bucket above it
+ * returns: void
+ */
+static inline void adaptive_move(adaptive_boundary *bnd)
+{
+    uint64_t th = __atomic_load_n(bnd->threshold, __ATOMIC_RELAXED);
+    uint64_t next;
+    // buckets entirely below and entirely above the threshold
+    size_t lo_bkt = 62 - __builtin_clzl(th);
+    size_t hi_bkt = 64 - __builtin_clzl(th - 1);
+
+    if (lo_bkt >= adaptive_min_bkt
+        && adaptive_wins(bnd->op, lo_bkt, bnd->above, bnd->below))
+        next = th - (th >> ADAPTIVE_STEP_SHIFT);
+    else if (hi_bkt < SC_BUCKET_COUNT
+        && adaptive_wins(bnd->op, hi_bkt, bnd->below, bnd->above))
+        next = th + (th >> ADAPTIVE_STEP_SHIFT);
+    else
+        return;
+
+    if (next < bnd->lo)
+        next = bnd->lo;
+    if (next > bnd->hi)
+        next = bnd->hi;
+    if (bnd->floor != NULL && next < __atomic_load_n(bnd->floor, __ATOMIC_RELAXED))
+        return;
+    if (bnd->ceil != NULL && next > __atomic_load_n(bnd->ceil, __ATOMIC_RELAXED))
+        return;
+    if (next != th)
+    {
+        __atomic_store_n(bnd->threshold, next, __ATOMIC_RELEASE);
+        LOG_DEBUG("Adaptive threshold %p: %lu -> %lu\n", (void *)bnd->threshold, th, next);
+    }
+}
+
+/* Revisits the boundaries, unless another thread updates them
+ * returns: void
+ */
+static inline void adaptive_update(void)
+{
+    if (__atomic_test_and_set(&libmem_update_lock, __ATOMIC_ACQUIRE))
+        return;
+    // explicit thresholds of libmem_set_thresholds() stop the adaptation
+    if (__atomic_load_n(&adaptive_active, __ATOMIC_RELAXED))
+    {
+        for (unsigned int idx = 0; idx < adaptive_boundary_count; idx++)
+            adaptive_move(&adaptive_boundaries[idx]);
+    }
+    libmem_update_end();
+}
+
+/* Folds the timing of a sampled call into the average of its bucket.
+ * Racing samples of a bucket may drop one another, the averages tolerate it.
+ * returns: void
+ */
+static inline void adaptive_record(adaptive_op op, size_t bkt, adaptive_strategy strategy,
+                                   uint64_t cycles, size_t size)
+{
+    adaptive_stat *stat = &adaptive_stats[op][bkt][strategy];
+    uint64_t cost = (cycles << ADAPTIVE_COST_SHIFT) / size;
+    uint32_t prev = __atomic_load_n(&stat->cost, __ATOMIC_RELAXED);
+    uint32_t samples = __atomic_load_n(&stat->samples, __ATOMIC_RELAXED);
+
+    if (cost > UINT32_MAX)
+        cost = UINT32_MAX;
+    if (samples != 0)
+        cost = (uint64_t)((int64_t)prev + (((int64_t)cost - prev) >> ADAPTIVE_EWMA_SHIFT));
+    __atomic_store_n(&stat->cost, (uint32_t)cost, __ATOMIC_RELAXED);
+    if (samples != UINT32_MAX)
+        __atomic_store_n(&stat->samples, samples + 1, __ATOMIC_RELAXED);
+
+    if (__atomic_add_fetch(&adaptive_samples, 1, __ATOMIC_RELAXED) % ADAPTIVE_UPDATE_RATE == 0)
+        adaptive_update();
+}
+
+/* Picks the strategy of the sample and the interval to the next one,
+ * uniform in [RATE/2, 3*RATE/2), from the thread's xorshift state
+ * returns: implementation, NULL if not supported by the cpu
+ */
+static inline func_ptr adaptive_strategy_impl(adaptive_op op, adaptive_strategy *strategy)
+{
+    uint32_t rnd = adaptive_seed;
+
+    if (rnd == 0)
+        rnd = (uint32_t)__rdtsc() | 1;
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    adaptive_seed = rnd;
+
+    adaptive_countdown = ADAPTIVE_SAMPLE_RATE / 2 + rnd % ADAPTIVE_SAMPLE_RATE;
+    *strategy = (rnd >> 16) % ADAPTIVE_STRATEGY_COUNT;
+    return adaptive_strategies[op][*strategy];
+}
+
+static __attribute__((noinline)) void *adaptive_sample_memcpy(void *dst, const void *src,
+                                                              size_t size, size_t bkt)
+{
+    adaptive_strategy strategy;
+    func_ptr impl = adaptive_strategy_impl(ADAPTIVE_MEMCPY, &strategy);
+
+    if (impl == NULL || !__atomic_load_n(&adaptive_active, __ATOMIC_RELAXED))
+        return adaptive_memcpy_impls[bkt](dst, src, size);
+
+    uint64_t start = __rdtsc();
+    ((amd_memcpy_fn)impl)(dst, src, size);
+    adaptive_record(ADAPTIVE_MEMCPY, bkt, strategy, __rdtsc() - start, size);
+    return dst;
+}
+
+static __attribute__((noinline)) void *adaptive_sample_memset(void *mem, int val,
+                                                              size_t size, size_t bkt)
+{
+    adaptive_strategy strategy;
+    func_ptr impl = adaptive_strategy_impl(ADAPTIVE_MEMSET, &strategy);
+
+    if (impl == NULL || !__atomic_load_n(&adaptive_active, __ATOMIC_RELAXED))
+        return adaptive_memset_impls[bkt](mem, val, size);
+
+    uint64_t start = __rdtsc();
+    ((amd_memset_fn)impl)(mem, val, size);
+    adaptive_record(ADAPTIVE_MEMSET, bkt, strategy, __rdtsc() - start, size);
+    return mem;
+}
+
+// Sampling entries of the memcpy and memset buckets
+static void *__memcpy_adaptive(void *dst, const void *src, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+
+    if (__builtin_expect(adaptive_countdown-- != 0, 1))
+        return adaptive_memcpy_impls[bkt](dst, src, size);
+    return adaptive_sample_memcpy(dst, src, size, bkt);
+}
+
+static void *__memset_adaptive(void *mem, int val, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+
+    if (__builtin_expect(adaptive_countdown-- != 0, 1))
+        return adaptive_memset_impls[bkt](mem, val, size);
+    return adaptive_sample_memset(mem, val, size, bkt);
+}
+
+/* Entry the bucket forwards to, seen through the sampling entries
+ * returns: function pointer
+ */
+static inline func_ptr adaptive_unwrap(func_index idx, func_ptr impl)
+{
+    if (impl == (func_ptr) __memcpy_adaptive && idx == MEMCPY)
+        return (func_ptr) adaptive_memcpy_impls[SC_BUCKET_COUNT - 1];
+    if (impl == (func_ptr) __memset_adaptive && idx == MEMSET)
+        return (func_ptr) adaptive_memset_impls[SC_BUCKET_COUNT - 1];
+    return impl;
+}
+
+/* Stops moving the thresholds, the sampling entries keep forwarding
+ * returns: void
+ */
+static inline void adaptive_stop(void)
+{
+    __atomic_store_n(&adaptive_active, false, __ATOMIC_RELAXED);
+}
+
+static inline void adaptive_add_boundary(uint64_t *threshold, uint64_t *floor, uint64_t *ceil,
+                                         adaptive_op op, adaptive_strategy below,
+                                         adaptive_strategy above)
+{
+    adaptive_boundary *bnd = &adaptive_boundaries[adaptive_boundary_count];
+    uint64_t th = *threshold;
+    size_t bkt;
+
+    // disabled or unbounded thresholds are left alone
+    if (th < (1UL << ADAPTIVE_BOUND_SHIFT) || th >= 0xffffffff)
+        return;
+
+    bnd->threshold = threshold;
+    bnd->floor = floor;
+    bnd->ceil = ceil;
+    bnd->lo = th >> ADAPTIVE_BOUND_SHIFT;
+    bnd->hi = th << ADAPTIVE_BOUND_SHIFT;
+    bnd->op = op;
+    bnd->below = below;
+    bnd->above = above;
+    adaptive_boundary_count++;
+
+    // sample from the bucket below the lowest position of the boundary
+    bkt = 62 - __builtin_clzl(bnd->lo);
+    if (bkt < adaptive_min_bkt)
+        adaptive_min_bkt = bkt;
+}
+
+/* Binds the sampling entries to the memcpy and memset buckets around the
+ * configured thresholds
+ * returns: void
+ */
+static inline void configure_adaptive(cpu_info *zen_info)
+{
+    if (zen_info->zen_cpu_features.avx2 != ENABLED)
+        return;
+
+    if (zen_info->zen_cpu_features.avx512 == ENABLED)
+    {
+        adaptive_strategies[ADAPTIVE_MEMCPY][ADAPTIVE_VEC] = (func_ptr) __memcpy_avx512_unaligned;
+        adaptive_strategies[ADAPTIVE_MEMCPY][ADAPTIVE_NT] = (func_ptr) __memcpy_avx512_nt_store;
+        adaptive_strategies[ADAPTIVE_MEMSET][ADAPTIVE_VEC] = (func_ptr) __memset_avx512_unaligned;
+        adaptive_strategies[ADAPTIVE_MEMSET][ADAPTIVE_NT] = (func_ptr) __memset_avx512_nt_store;
+    }
+    else
+    {
+        adaptive_strategies[ADAPTIVE_MEMCPY][ADAPTIVE_VEC] = (func_ptr) __memcpy_avx2_unaligned;
+        adaptive_strategies[ADAPTIVE_MEMCPY][ADAPTIVE_NT] = (func_ptr) __memcpy_avx2_nt_store;
+        adaptive_strategies[ADAPTIVE_MEMSET][ADAPTIVE_VEC] = (func_ptr) __memset_avx2_unaligned;
+        adaptive_strategies[ADAPTIVE_MEMSET][ADAPTIVE_NT] = (func_ptr) __memset_avx2_nt_store;
+    }
+
+    if (zen_info->zen_cpu_features.erms == ENABLED)
+    {
+        adaptive_strategies[ADAPTIVE_MEMCPY][ADAPTIVE_ERMS] = (func_ptr) __memcpy_erms_b_aligned;
+        adaptive_strategies[ADAPTIVE_MEMSET][ADAPTIVE_ERMS] = (func_ptr) __memset_erms_b_aligned;
+
+        adaptive_add_boundary(&__repmov_start_threshold, NULL, &__repmov_stop_threshold,
+                              ADAPTIVE_MEMCPY, ADAPTIVE_VEC, ADAPTIVE_ERMS);
+        adaptive_add_boundary(&__repmov_stop_threshold, &__repmov_start_threshold, NULL,
+                              ADAPTIVE_MEMCPY, ADAPTIVE_ERMS, ADAPTIVE_VEC);
+        adaptive_add_boundary(&__repstore_start_threshold, NULL, &__repstore_stop_threshold,
+                              ADAPTIVE_MEMSET, ADAPTIVE_VEC, ADAPTIVE_ERMS);
+        adaptive_add_boundary(&__repstore_stop_threshold, &__repstore_start_threshold, NULL,
+                              ADAPTIVE_MEMSET, ADAPTIVE_ERMS, ADAPTIVE_NT);
+    }
+    adaptive_add_boundary(&__nt_start_threshold, NULL, &__nt_stop_threshold,
+                          ADAPTIVE_MEMCPY, ADAPTIVE_VEC, ADAPTIVE_NT);
+
+    if (adaptive_boundary_count == 0)
+        return;
+
+    // the adapted thresholds apply to every core class
+    __core_class_count = 1;
+
+    for (size_t bkt = adaptive_min_bkt; bkt < SC_BUCKET_COUNT; bkt++)
+    {
+        adaptive_memcpy_impls[bkt] = _memcpy_sc_variants[bkt];
+        adaptive_memset_impls[bkt] = _memset_sc_variants[bkt];
+        _memcpy_sc_variants[bkt] = __memcpy_adaptive;
+        _memset_sc_variants[bkt] = __memset_adaptive;
+    }
+    adaptive_active = true;
+    LOG_INFO("Adaptive thresholds from %lu Bytes on\n", 1UL << adaptive_min_bkt);
+}
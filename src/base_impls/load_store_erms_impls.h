@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -35,54 +35,62 @@ extern "C" {
 
 static inline void *__erms_movsb(void *dst, const void *src, size_t len)
 {
+    void *ret = dst;
+
     asm volatile("cld\n\t"
                  "rep movsb"
                  : "+D"(dst), "+S"(src), "+c"(len)
                  :
                  : "memory", "cc");
-    return dst;
+    return ret;
 }
 
 static inline void *__erms_movsw(void *dst, const void *src, size_t len)
 {
+    void *ret = dst;
+
     asm volatile("sar $1, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsw"
                  : "+D"(dst), "+S"(src), "+c"(len)
                  :
                  : "memory", "cc");
-    return dst;
+    return ret;
 }
 
 static inline void *__erms_movsd(void *dst, const void *src, size_t len)
 {
+    void *ret = dst;
+
     asm volatile("sar $2, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsd"
                  : "+D"(dst), "+S"(src), "+c"(len)
                  :
                  : "memory", "cc");
-    return dst;
+    return ret;
 }
 
 static inline void *__erms_movsq(void *dst, const void *src, size_t len)
 {
+    void *ret = dst;
+
     asm volatile("sar $3, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsq"
                  : "+D"(dst), "+S"(src), "+c"(len)
                  :
                  : "memory", "cc");
-    return dst;
+    return ret;
 }
 
 static inline void *__erms_movsb_last_byte(void *dst, const void *src, size_t len)
 {
     asm volatile("cld\n\t"
                  "rep movsb"
-                 : "+D"(dst)
-                 : "S"(src), "c"(len)
-                 : "memory");
+                 : "+D"(dst), "+S"(src), "+c"(len)
+                 :
+                 : "memory", "cc");
     return dst;
 }
 
@@ -91,9 +99,9 @@ static inline void *__erms_movsw_last_byte(void *dst, const void *src, size_t le
     asm volatile("sar $1, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsw"
-                 : "+D"(dst)
-                 : "S"(src), "c"(len)
-                 : "memory");
+                 : "+D"(dst), "+S"(src), "+c"(len)
+                 :
+                 : "memory", "cc");
     return dst;
 }
 
@@ -102,9 +110,9 @@ static inline void *__erms_movsd_last_byte(void *dst, const void *src, size_t le
     asm volatile("sar $2, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsd"
-                 : "+D"(dst)
-                 : "S"(src), "c"(len)
-                 : "memory");
+                 : "+D"(dst), "+S"(src), "+c"(len)
+                 :
+                 : "memory", "cc");
     return dst;
 }
 
@@ -113,57 +121,68 @@ static inline void *__erms_movsq_last_byte(void *dst, const void *src, size_t le
     asm volatile("sar $3, %%rcx\n\t"
                  "cld\n\t"
                  "rep movsq"
-                 : "+D"(dst)
-                 : "S"(src), "c"(len)
-                 : "memory");
+                 : "+D"(dst), "+S"(src), "+c"(len)
+                 :
+                 : "memory", "cc");
     return dst;
 }
 
 static inline void *__erms_movsb_back(void *dst, const void *src, size_t len)
 {
-    asm volatile("movq %%rdi, %%rax\n\t"
-                 "std\n\t"
+    void *last_dst = dst + len - 1;
+    const void *last_src = src + len - 1;
+
+    asm volatile("std\n\t"
                  "rep movsb\n\t"
                  "cld"
+                 : "+D"(last_dst), "+S"(last_src), "+c"(len)
                  :
-                 : "D"(dst + len - 1), "S"(src + len - 1), "c"(len)
-                 : "memory");
+                 : "memory", "cc");
     return dst;
 }
 
 static inline void *__erms_movsw_back(void *dst, const void *src, size_t len)
 {
+    void *last_dst = dst + len - WORD_SZ;
+    const void *last_src = src + len - WORD_SZ;
+
     asm volatile("sar $1, %%rcx\n\t"
                  "std\n\t"
                  "rep movsw\n\t"
                  "cld"
+                 : "+D"(last_dst), "+S"(last_src), "+c"(len)
                  :
-                 : "D"(dst + len - WORD_SZ), "S"(src + len - WORD_SZ), "c"(len)
-                 : "memory");
+                 : "memory", "cc");
     return dst;
 }
 
 static inline void *__erms_movsd_back(void *dst, const void *src, size_t len)
 {
+    void *last_dst = dst + len - DWORD_SZ;
+    const void *last_src = src + len - DWORD_SZ;
+
     asm volatile("sar $2, %%rcx\n\t"
                  "std\n\t"
                  "rep movsd\n\t"
                  "cld"
+                 : "+D"(last_dst), "+S"(last_src), "+c"(len)
                  :
-                 : "D"(dst + len - DWORD_SZ), "S"(src + len - DWORD_SZ), "c"(len)
-                 : "memory");
+                 : "memory", "cc");
     return dst;
 }
 
 static inline void *__erms_movsq_back(void *dst, const void *src, size_t len)
 {
+    void *last_dst = dst + len - QWORD_SZ;
+    const void *last_src = src + len - QWORD_SZ;
+
     asm volatile("sar $3, %%rcx\n\t"
                  "std\n\t"
                  "rep movsq\n\t"
                  "cld"
+                 : "+D"(last_dst), "+S"(last_src), "+c"(len)
                  :
-                 : "D"(dst + len - QWORD_SZ), "S"(src + len - QWORD_SZ), "c"(len)
-                 : "memory");
+                 : "memory", "cc");
     return dst;
 }
 
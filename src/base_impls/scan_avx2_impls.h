@@ -0,0 +1,131 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LIBMEM_SCAN_AVX2_IMPLS_H_
+#define _LIBMEM_SCAN_AVX2_IMPLS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <immintrin.h>
+#include "almem_defs.h"
+#include "zen_cpu_info.h"
+
+// Distance the non-temporal scans prefetch ahead of the loads
+#define SCAN_NT_PREFETCH_DIST   (32 * YMM_SZ)
+
+/* Bytes of the vector to stop at: equal to chr, or also NUL when nul is set.
+ * Both are the zero bytes of min(vec ^ chr, vec).
+ */
+static inline __m256i __scan_stop_bytes_avx2(__m256i y, __m256i yc, bool nul)
+{
+    __m256i yx = _mm256_xor_si256(y, yc);
+
+    return nul ? _mm256_min_epu8(yx, y) : yx;
+}
+
+static inline uint32_t __scan_zero_mask_avx2(__m256i y)
+{
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(y, _mm256_setzero_si256()));
+}
+
+/* Long-scan of str[0, max) for chr, or also NUL with nul set.
+ * The head vector is loaded from the YMM_SZ aligned address below str, the rest
+ * in blocks of 4 aligned vectors: an aligned vector holding a valid byte never
+ * crosses into another page, so bytes past the stop byte or past max are read
+ * without faulting and are discarded. With nt set, the loop prefetches ahead with
+ * the NTA hint to keep a scan over a huge buffer out of the caches.
+ * returns: offset of the first stop byte, max if there is none
+ */
+static inline __attribute__((always_inline)) size_t __scan_avx2(const char *str, size_t max,
+                                                                  int chr, bool nul, bool nt)
+{
+    __m256i yc, y0, y1, y2, y3, ym;
+    const char *base;
+    size_t head, offset, found;
+    uint32_t mask;
+
+    if (max == 0)
+        return 0;
+
+    yc = _mm256_set1_epi8((char)chr);
+    base = (const char *)((uintptr_t)str & ~(uintptr_t)(YMM_SZ - 1));
+    head = str - base;
+
+    mask = __scan_zero_mask_avx2(__scan_stop_bytes_avx2(_mm256_load_si256((const __m256i *)base),
+                                                        yc, nul)) >> head;
+    if (mask)
+    {
+        found = _tzcnt_u32(mask);
+        return found < max ? found : max;
+    }
+
+    // single vectors up to the 4 * YMM_SZ aligned block
+    offset = YMM_SZ;
+    while ((offset - head < max) && ((uintptr_t)(base + offset) & (4 * YMM_SZ - 1)))
+    {
+        mask = __scan_zero_mask_avx2(__scan_stop_bytes_avx2(
+                    _mm256_load_si256((const __m256i *)(base + offset)), yc, nul));
+        if (mask)
+        {
+            found = offset - head + _tzcnt_u32(mask);
+            return found < max ? found : max;
+        }
+        offset += YMM_SZ;
+    }
+
+    while (offset - head < max)
+    {
+        if (nt)
+        {
+            // one prefetch per cache line of the 4 * YMM_SZ block
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST, _MM_HINT_NTA);
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST + 2 * YMM_SZ, _MM_HINT_NTA);
+        }
+        y0 = __scan_stop_bytes_avx2(_mm256_load_si256((const __m256i *)(base + offset + 0 * YMM_SZ)), yc, nul);
+        y1 = __scan_stop_bytes_avx2(_mm256_load_si256((const __m256i *)(base + offset + 1 * YMM_SZ)), yc, nul);
+        y2 = __scan_stop_bytes_avx2(_mm256_load_si256((const __m256i *)(base + offset + 2 * YMM_SZ)), yc, nul);
+        y3 = __scan_stop_bytes_avx2(_mm256_load_si256((const __m256i *)(base + offset + 3 * YMM_SZ)), yc, nul);
+        ym = _mm256_min_epu8(_mm256_min_epu8(y0, y1), _mm256_min_epu8(y2, y3));
+
+        if (__scan_zero_mask_avx2(ym))
+        {
+            found = offset - head;
+            if ((mask = __scan_zero_mask_avx2(y0)))
+                found += _tzcnt_u32(mask);
+            else if ((mask = __scan_zero_mask_avx2(y1)))
+                found += YMM_SZ + _tzcnt_u32(mask);
+            else if ((mask = __scan_zero_mask_avx2(y2)))
+                found += 2 * YMM_SZ + _tzcnt_u32(mask);
+            else
+                found += 3 * YMM_SZ + _tzcnt_u32(__scan_zero_mask_avx2(y3));
+            return found < max ? found : max;
+        }
+        offset += 4 * YMM_SZ;
+    }
+    return max;
+}
+
+#endif //HEADER
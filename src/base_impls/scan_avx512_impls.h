@@ -0,0 +1,128 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LIBMEM_SCAN_AVX512_IMPLS_H_
+#define _LIBMEM_SCAN_AVX512_IMPLS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <immintrin.h>
+#include "almem_defs.h"
+#include "zen_cpu_info.h"
+
+// Distance the non-temporal scans prefetch ahead of the loads
+#define SCAN_NT_PREFETCH_DIST   (16 * ZMM_SZ)
+
+/* Bytes of the vector to stop at: equal to chr, or also NUL when nul is set.
+ * Both are the zero bytes of min(vec ^ chr, vec).
+ */
+static inline __m512i __scan_stop_bytes_avx512(__m512i z, __m512i zc, bool nul)
+{
+    __m512i zx = _mm512_xor_si512(z, zc);
+
+    return nul ? _mm512_min_epu8(zx, z) : zx;
+}
+
+/* Long-scan of str[0, max) for chr, or also NUL with nul set.
+ * The head vector is loaded from the ZMM_SZ aligned address below str, the rest
+ * in blocks of 4 aligned vectors: an aligned vector holding a valid byte never
+ * crosses into another page, so bytes past the stop byte or past max are read
+ * without faulting and are discarded. With nt set, the loop prefetches ahead with
+ * the NTA hint to keep a scan over a huge buffer out of the caches.
+ * returns: offset of the first stop byte, max if there is none
+ */
+static inline __attribute__((always_inline)) size_t __scan_avx512(const char *str, size_t max,
+                                                                    int chr, bool nul, bool nt)
+{
+    __m512i zc, z0, z1, z2, z3, zm;
+    const char *base;
+    size_t head, offset, found;
+    uint64_t mask;
+
+    if (max == 0)
+        return 0;
+
+    zc = _mm512_set1_epi8((char)chr);
+    base = (const char *)((uintptr_t)str & ~(uintptr_t)(ZMM_SZ - 1));
+    head = str - base;
+
+    mask = _mm512_testn_epi8_mask(__scan_stop_bytes_avx512(_mm512_load_si512(base), zc, nul),
+                                  _mm512_set1_epi8(0xff)) >> head;
+    if (mask)
+    {
+        found = _tzcnt_u64(mask);
+        return found < max ? found : max;
+    }
+
+    // single vectors up to the 4 * ZMM_SZ aligned block
+    offset = ZMM_SZ;
+    while ((offset - head < max) && ((uintptr_t)(base + offset) & (4 * ZMM_SZ - 1)))
+    {
+        mask = _mm512_testn_epi8_mask(__scan_stop_bytes_avx512(_mm512_load_si512(base + offset), zc, nul),
+                                      _mm512_set1_epi8(0xff));
+        if (mask)
+        {
+            found = offset - head + _tzcnt_u64(mask);
+            return found < max ? found : max;
+        }
+        offset += ZMM_SZ;
+    }
+
+    while (offset - head < max)
+    {
+        if (nt)
+        {
+            // one prefetch per cache line of the 4 * ZMM_SZ block
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST + 0 * ZMM_SZ, _MM_HINT_NTA);
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST + 1 * ZMM_SZ, _MM_HINT_NTA);
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST + 2 * ZMM_SZ, _MM_HINT_NTA);
+            _mm_prefetch(base + offset + SCAN_NT_PREFETCH_DIST + 3 * ZMM_SZ, _MM_HINT_NTA);
+        }
+        z0 = __scan_stop_bytes_avx512(_mm512_load_si512(base + offset + 0 * ZMM_SZ), zc, nul);
+        z1 = __scan_stop_bytes_avx512(_mm512_load_si512(base + offset + 1 * ZMM_SZ), zc, nul);
+        z2 = __scan_stop_bytes_avx512(_mm512_load_si512(base + offset + 2 * ZMM_SZ), zc, nul);
+        z3 = __scan_stop_bytes_avx512(_mm512_load_si512(base + offset + 3 * ZMM_SZ), zc, nul);
+        zm = _mm512_min_epu8(_mm512_min_epu8(z0, z1), _mm512_min_epu8(z2, z3));
+
+        if (_mm512_testn_epi8_mask(zm, zm))
+        {
+            found = offset - head;
+            if ((mask = _mm512_testn_epi8_mask(z0, z0)))
+                found += _tzcnt_u64(mask);
+            else if ((mask = _mm512_testn_epi8_mask(z1, z1)))
+                found += ZMM_SZ + _tzcnt_u64(mask);
+            else if ((mask = _mm512_testn_epi8_mask(z2, z2)))
+                found += 2 * ZMM_SZ + _tzcnt_u64(mask);
+            else
+                found += 3 * ZMM_SZ + _tzcnt_u64(_mm512_testn_epi8_mask(z3, z3));
+            return found < max ? found : max;
+        }
+        offset += 4 * ZMM_SZ;
+    }
+    return max;
+}
+
+#endif //HEADER
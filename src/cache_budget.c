@@ -0,0 +1,239 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+
+/*
+ * Cache budget of the process: the L3 slice granted by the resctrl L3 CAT
+ * schemata and the CPUs allowed by the affinity mask and the cgroup cpuset.
+ * The files are read with plain open/read into stack buffers as the budget
+ * is computed from the library constructor, before any allocator is ready.
+ * All the paths are relative to a root ("" by default), which tunables
+ * builds take from LIBMEM_SYSFS_ROOT to run on a faked sysfs tree.
+ */
+
+#define SYSFS_PATH_SZ       512
+#define SYSFS_BUF_SZ        4096
+#define AFFINITY_MASK_WORDS 64  //CPU mask of upto 4096 CPUs
+
+#define PROC_CGROUP         "/proc/self/cgroup"
+#define PROC_RESCTRL        "/proc/self/cpu_resctrl_groups"
+#define CGROUP_ROOT         "/sys/fs/cgroup"
+#define RESCTRL_ROOT        "/sys/fs/resctrl"
+
+/* Reads the file under the sysfs root as a NUL terminated string
+ * returns: bytes read, -1 on failure
+ */
+static inline ssize_t read_sysfs_file(const char *root, const char *path, char *buf)
+{
+    char full_path[SYSFS_PATH_SZ];
+    ssize_t bytes;
+    int fd;
+
+    if (snprintf(full_path, SYSFS_PATH_SZ, "%s%s", root, path) >= SYSFS_PATH_SZ)
+        return -1;
+
+    fd = open(full_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+
+    bytes = read(fd, buf, SYSFS_BUF_SZ - 1);
+    close(fd);
+    if (bytes < 0)
+        return -1;
+
+    buf[bytes] = '\0';
+    return bytes;
+}
+
+/* Counts the CPUs the process is allowed to run on
+ * returns: CPU count, 0 on failure
+ */
+static inline unsigned int get_affinity_cpus(void)
+{
+    uint64_t cpu_mask[AFFINITY_MASK_WORDS] = {0};
+    unsigned int cpus = 0;
+    long mask_bytes;
+
+    mask_bytes = syscall(SYS_sched_getaffinity, 0, sizeof(cpu_mask), cpu_mask);
+    for (long word = 0; word < mask_bytes / (long)sizeof(uint64_t); word++)
+        cpus += __builtin_popcountll(cpu_mask[word]);
+
+    return cpus;
+}
+
+/* Counts the CPUs of a cpu list such as "0-3,8,10-11", tagging them in
+ * cpu_map, when not NULL, with the given tag
+ * returns: CPU count, 0 on empty or malformed list
+ */
+static inline unsigned int parse_cpu_list(const char *cpu_list, uint8_t *cpu_map,
+                                          size_t map_sz, uint8_t tag)
+{
+    unsigned int cpus = 0;
+    char *end;
+
+    while (*cpu_list >= '0' && *cpu_list <= '9')
+    {
+        unsigned long first = strtoul(cpu_list, &end, 10);
+        unsigned long last = first;
+
+        if (*end == '-')
+            last = strtoul(end + 1, &end, 10);
+        if (last < first)
+            return 0;
+        cpus += last - first + 1;
+
+        for (unsigned long cpu = first; cpu_map != NULL && cpu <= last && cpu < map_sz; cpu++)
+            cpu_map[cpu] = tag;
+
+        if (*end != ',')
+            break;
+        cpu_list = end + 1;
+    }
+    return cpus;
+}
+
+/* Counts the CPUs of the cpuset of the cgroup the process belongs to.
+ * cgroup v2 ("0::<path>") and v1 ("<id>:...cpuset...:<path>") hierarchies
+ * are expected at their default mount points.
+ * returns: CPU count, 0 if unknown
+ */
+static inline unsigned int get_cpuset_cpus(const char *root)
+{
+    char buf[SYSFS_BUF_SZ], cpu_list[SYSFS_BUF_SZ], path[SYSFS_PATH_SZ];
+    char *line, *next;
+
+    if (read_sysfs_file(root, PROC_CGROUP, buf) <= 0)
+        return 0;
+
+    for (line = buf; line != NULL && *line; line = next)
+    {
+        char *controllers, *cgroup;
+        int len = 0;
+
+        next = strchr(line, '\n');
+        if (next != NULL)
+            *next++ = '\0';
+
+        controllers = strchr(line, ':');
+        if (controllers == NULL)
+            continue;
+        controllers++;
+        cgroup = strchr(controllers, ':');
+        if (cgroup == NULL)
+            continue;
+        *cgroup++ = '\0';
+
+        if (*controllers == '\0')  //cgroup v2 unified hierarchy
+            len = snprintf(path, SYSFS_PATH_SZ, CGROUP_ROOT "%s/cpuset.cpus.effective", cgroup);
+        else if (strstr(controllers, "cpuset") != NULL)
+            len = snprintf(path, SYSFS_PATH_SZ, CGROUP_ROOT "/cpuset%s/cpuset.effective_cpus", cgroup);
+        else
+            continue;
+
+        // hybrid setups mount the cpuset controller on only one of the hierarchies
+        if (len < SYSFS_PATH_SZ && read_sysfs_file(root, path, cpu_list) > 0)
+            return parse_cpu_list(cpu_list, NULL, 0, 0);
+    }
+    return 0;
+}
+
+/* Computes the fraction of the L3 ways granted to the resctrl group of the
+ * process: the smallest L3 (or L3DATA with CDP) capacity bitmask across the
+ * cache domains of the group schemata over the full bitmask.
+ * returns: granted and total ways, 0 total ways if unknown
+ */
+static inline void get_resctrl_l3_ways(const char *root, unsigned int *ways,
+                                       unsigned int *total_ways)
+{
+    char buf[SYSFS_BUF_SZ], path[SYSFS_PATH_SZ];
+    char group[SYSFS_PATH_SZ] = "";
+    const char *resource;
+    char *line, *mask;
+
+    *total_ways = 0;
+
+    // "res:<group>" names the control group, "/" being the default group
+    if (read_sysfs_file(root, PROC_RESCTRL, buf) <= 0 || strncmp(buf, "res:", 4))
+        return;
+    line = buf + 4;
+    line[strcspn(line, "\n")] = '\0';
+    if (strcmp(line, "/") != 0)
+        snprintf(group, SYSFS_PATH_SZ, "%s", line);
+
+    if (snprintf(path, SYSFS_PATH_SZ, RESCTRL_ROOT "%s/schemata", group) >= SYSFS_PATH_SZ
+        || read_sysfs_file(root, path, buf) <= 0)
+        return;
+
+    resource = "L3";
+    line = strstr(buf, "L3:");
+    if (line == NULL)
+    {
+        resource = "L3DATA";
+        line = strstr(buf, "L3DATA:");
+    }
+    if (line == NULL)
+        return;
+    line[strcspn(line, "\n")] = '\0';
+
+    *ways = ~0U;
+    for (mask = strchr(line, '='); mask != NULL; mask = strchr(mask, '='))
+    {
+        unsigned int domain_ways = __builtin_popcountll(strtoull(mask + 1, &mask, 16));
+        if (domain_ways < *ways)
+            *ways = domain_ways;
+    }
+
+    snprintf(path, SYSFS_PATH_SZ, RESCTRL_ROOT "/info/%s/cbm_mask", resource);
+    if (*ways != ~0U && read_sysfs_file(root, path, buf) > 0)
+        *total_ways = __builtin_popcountll(strtoull(buf, NULL, 16));
+}
+
+/* Computes the L3 and CPUs available to the process
+ * returns: void
+ */
+static inline void get_cache_budget(cpu_info *zen_info, const char *root)
+{
+    cache_budget *budget = &(zen_info->zen_cache_budget);
+    unsigned int cpuset_cpus, ways = 0, total_ways;
+
+    budget->l3_per_ccx = zen_info->zen_cache_info.l3_per_ccx;
+    get_resctrl_l3_ways(root, &ways, &total_ways);
+    if (total_ways != 0 && ways != 0 && ways < total_ways)
+        budget->l3_per_ccx = budget->l3_per_ccx * ways / total_ways;
+
+    budget->cpus = get_affinity_cpus();
+    cpuset_cpus = get_cpuset_cpus(root);
+    if (cpuset_cpus != 0 && (budget->cpus == 0 || cpuset_cpus < budget->cpus))
+        budget->cpus = cpuset_cpus;
+
+    LOG_DEBUG("L3 budget/CCX: %lu, CPUs: %u (resctrl ways: %u/%u, cpuset CPUs: %u)\n",
+              budget->l3_per_ccx, budget->cpus, ways, total_ways, cpuset_cpus);
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -25,36 +25,79 @@
 
 #include "cpu_features.c"
 
+/* Size and sharing threads of the data or unified cache of a level
+ * returns: cache size in Bytes, 0 if the level is not reported
+ */
+static inline uint64_t get_cache_level_info(uint32_t leaf, uint32_t level, unsigned int *threads)
+{
+    cpuid_registers cpuid_regs;
+
+    for (uint32_t subleaf = 0; subleaf < CACHE_LEAF_MAX_SUBLEAF; subleaf++)
+    {
+        cpuid_regs.eax = leaf;
+        cpuid_regs.ecx = subleaf;
+        __get_cpu_features(&cpuid_regs);
+
+        if (CACHE_TYPE(cpuid_regs.eax) == CACHE_TYPE_NULL)
+            break;
+        if (CACHE_LEVEL(cpuid_regs.eax) != level || CACHE_TYPE(cpuid_regs.eax) == CACHE_TYPE_INSTR)
+            continue;
+        *threads = CACHE_SHARING_THREADS(cpuid_regs.eax);
+        return CACHE_SIZE(cpuid_regs.ebx, cpuid_regs.ecx);
+    }
+    return 0;
+}
+
 static inline void get_cache_info(cpu_info *zen_info)
 {
     cpuid_registers cpuid_regs;
 
     cache_info *zen_cache = &(zen_info->zen_cache_info);
+    thread_info *zen_thread = &(zen_info->zen_thread_info);
+    unsigned int ccx_per_ccd, threads = 1;
+    uint32_t leaf = AMD_CACHE_LEAF;
 
-    //get L1D cache details
-    cpuid_regs.eax = 0x8000001D;
-    cpuid_regs.ecx = 0x0;
-    __get_cpu_features(&cpuid_regs);
+    if (!is_amd_vendor(zen_info->vendor))
+    {
+        leaf = X86_CACHE_LEAF;
+        cpuid_regs.eax = 0x0;
+        cpuid_regs.ecx = 0x0;
+        __get_cpu_features(&cpuid_regs);
+        if (cpuid_regs.eax < X86_CACHE_LEAF)
+        {
+            LOG_WARN("CPUID cache leaf not supported\n");
+            return;
+        }
+    }
 
     //Compute L1D Cache Info
-    zen_cache->l1d_per_core = (((cpuid_regs.ebx>>22) & 0x3ff)+1)*((cpuid_regs.ebx & 0xfff)+1)*(cpuid_regs.ecx+1);
-
-
-    //get L2 cache details
-    cpuid_regs.eax = 0x8000001D;
-    cpuid_regs.ecx = 0x2;
-    __get_cpu_features(&cpuid_regs);
+    zen_cache->l1d_per_core = get_cache_level_info(leaf, 1, &threads);
 
     //Compute L2 Cache Info
-    zen_cache->l2_per_core = (((cpuid_regs.ebx>>22) & 0x3ff)+1)*((cpuid_regs.ebx & 0xfff)+1)*(cpuid_regs.ecx+1);
+    zen_cache->l2_per_core = get_cache_level_info(leaf, 2, &threads);
 
-    //get L3 cache details
-    cpuid_regs.eax = 0x8000001D;
-    cpuid_regs.ecx = 0x3;
-    __get_cpu_features(&cpuid_regs);
+    //L2 is private to the core: its sharing threads are the SMT siblings
+    zen_thread->threads_per_core = threads;
 
     //Compute L3 Cache info
-    zen_cache->l3_per_ccx =  (((cpuid_regs.ebx>>22) & 0x3ff)+1)*((cpuid_regs.ebx & 0xfff)+1)*(cpuid_regs.ecx+1);
+    zen_cache->l3_per_ccx = get_cache_level_info(leaf, 3, &threads);
+    zen_thread->threads_per_ccx = threads;
+
+    //Parts without L3 share the L2 as last level cache
+    if (zen_cache->l3_per_ccx == 0)
+    {
+        zen_cache->l3_per_ccx = zen_cache->l2_per_core;
+        zen_thread->threads_per_ccx = zen_thread->threads_per_core;
+    }
+
+    //Zen1/Zen2 CCDs carry two CCXs, from Zen3 onwards the CCX spans the CCD.
+    //Other vendors have no CCDs: the L3 slice spans the die.
+    ccx_per_ccd = (is_amd_vendor(zen_info->vendor) && zen_info->zen_cpu_features.vpclmul != ENABLED) ? 2 : 1;
+    zen_cache->l3_per_ccd = zen_cache->l3_per_ccx * ccx_per_ccd;
+    zen_thread->threads_per_ccd = zen_thread->threads_per_ccx * ccx_per_ccd;
 
-    LOG_DEBUG("L2 Cache/CORE: %lu, L3 Cache/CCX: %lu\n", zen_cache->l2_per_core, zen_cache->l3_per_ccx);
+    LOG_DEBUG("L2 Cache/CORE: %lu, L3 Cache/CCX: %lu, L3 Cache/CCD: %lu\n", zen_cache->l2_per_core,
+              zen_cache->l3_per_ccx, zen_cache->l3_per_ccd);
+    LOG_DEBUG("Threads/CORE: %u, Threads/CCX: %u, Threads/CCD: %u\n", zen_thread->threads_per_core,
+              zen_thread->threads_per_ccx, zen_thread->threads_per_ccd);
 }
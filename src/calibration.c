@@ -0,0 +1,326 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <time.h>
+#include <sys/mman.h>
+#include <x86intrin.h>
+
+/*
+ * Startup calibration (LIBMEM_CALIBRATE=1): times the vector, ERMS and NT
+ * implementations of memcpy and memset on doubling sizes around the
+ * formula thresholds, refining each crossover with a few bisection steps.
+ * Measuring stops once CALIB_BUDGET_NS is spent, thresholds left unmeasured
+ * keep their formula values. The results are cached in a file named after
+ * the CPUID signature, later processes of the host load them instead.
+ */
+
+#define CALIB_BUDGET_NS     (20 * 1000 * 1000)
+#define CALIB_BUF_MAX       (16UL * 1024 * 1024)   //per buffer, bounds the NT candidates
+#define CALIB_REPS          3
+#define CALIB_BISECT_STEPS  2
+#define CALIB_FILE_FMT      "/var/tmp/libmem-calibration-%08x.cfg"
+#define CALIB_FIELDS        9
+
+typedef enum {
+    CALIB_MEMCPY,
+    CALIB_MEMSET
+} calib_op;
+
+typedef struct {
+    struct timespec start;
+    uint8_t *src;
+    uint8_t *dst;
+    uint64_t buf_sz;
+    bool budget_exceeded;
+} calib_ctx;
+
+/* Checks the elapsed calibration time against the budget
+ * returns: true once the budget is spent
+ */
+static inline bool calib_budget_exceeded(calib_ctx *ctx)
+{
+    struct timespec now;
+
+    if (ctx->budget_exceeded)
+        return true;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    ctx->budget_exceeded = (uint64_t)(now.tv_sec - ctx->start.tv_sec) * 1000000000UL
+                            + now.tv_nsec - ctx->start.tv_nsec > CALIB_BUDGET_NS;
+    return ctx->budget_exceeded;
+}
+
+/* Times the implementation on the calibration buffers, best of CALIB_REPS
+ * returns: TSC cycles
+ */
+static inline uint64_t calib_time(calib_ctx *ctx, calib_op op, func_ptr impl, uint64_t size)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (int rep = 0; rep < CALIB_REPS; rep++)
+    {
+        uint64_t start = __rdtsc();
+
+        if (op == CALIB_MEMCPY)
+            ((amd_memcpy_fn)impl)(ctx->dst, ctx->src, size);
+        else
+            ((amd_memset_fn)impl)(ctx->dst, rep, size);
+
+        uint64_t cycles = __rdtsc() - start;
+        if (cycles < best)
+            best = cycles;
+    }
+    return best;
+}
+
+/* Checks the second implementation is no slower than the first one
+ * returns: true if it is
+ */
+static inline bool calib_faster(calib_ctx *ctx, calib_op op, func_ptr impl, func_ptr next_impl,
+                                uint64_t size)
+{
+    return calib_time(ctx, op, next_impl, size) <= calib_time(ctx, op, impl, size);
+}
+
+/* Finds the size from which next_impl overtakes impl within [lo, hi]
+ * returns: crossover size, 0 if not found within the range or the budget
+ */
+static inline uint64_t calib_crossover(calib_ctx *ctx, calib_op op, func_ptr impl,
+                                       func_ptr next_impl, uint64_t lo, uint64_t hi)
+{
+    uint64_t size, below;
+
+    if (hi > ctx->buf_sz)
+        hi = ctx->buf_sz;
+
+    for (size = lo; size <= hi; size <<= 1)
+    {
+        if (calib_budget_exceeded(ctx))
+            return 0;
+        if (calib_faster(ctx, op, impl, next_impl, size))
+            break;
+    }
+    if (size > hi)
+        return 0;
+    if (size == lo)
+        return size;
+
+    // crossover lies in (size/2, size]
+    below = size >> 1;
+    for (int step = 0; step < CALIB_BISECT_STEPS && !calib_budget_exceeded(ctx); step++)
+    {
+        uint64_t mid = below + ((size - below) >> 1);
+        if (calib_faster(ctx, op, impl, next_impl, mid))
+            size = mid;
+        else
+            below = mid;
+    }
+    return size;
+}
+
+/* Signature of the host the calibration is valid for: CPUID family, model
+ * and stepping, with the cache budget and sharing the formulas start from
+ */
+static inline void calib_signature(cpu_info *zen_info, uint64_t key[4])
+{
+    cpuid_registers cpuid_regs;
+
+    cpuid_regs.eax = 0x1;
+    cpuid_regs.ecx = 0;
+    __get_cpu_features(&cpuid_regs);
+
+    key[0] = cpuid_regs.eax;
+    key[1] = zen_info->zen_cache_info.l2_per_core;
+    key[2] = zen_info->zen_cache_budget.l3_per_ccx;
+    key[3] = get_l3_sharing_threads(zen_info, zen_info->zen_thread_info.threads_per_ccx,
+                                     get_l3_sharing_cfg());
+}
+
+/* Path of the calibration cache file of the host
+ * returns: void
+ */
+static inline void calib_file_path(uint64_t key[4], char *path)
+{
+    if (user_config.calib_file != NULL)
+        snprintf(path, SYSFS_PATH_SZ, "%s", user_config.calib_file);
+    else
+        snprintf(path, SYSFS_PATH_SZ, CALIB_FILE_FMT, (uint32_t)key[0]);
+}
+
+/* Loads the calibrated thresholds cached for the signature
+ * returns: true if loaded
+ */
+static inline bool calib_load(cpu_info *zen_info, uint64_t key[4], const char *path)
+{
+    char buf[SYSFS_BUF_SZ];
+    uint64_t fields[CALIB_FIELDS];
+    char *next = buf;
+
+    if (read_sysfs_file("", path, buf) <= 0)
+        return false;
+
+    for (int idx = 0; idx < CALIB_FIELDS; idx++)
+    {
+        char *end;
+        fields[idx] = strtoull(next, &end, 0);
+        if (end == next)
+            return false;
+        next = end;
+    }
+    if (memcmp(fields, key, 4 * sizeof(uint64_t)) != 0)
+    {
+        LOG_INFO("Calibration cache %s belongs to another host config\n", path);
+        return false;
+    }
+
+    zen_info->zen_thresholds.repmov_start_threshold = fields[4];
+    zen_info->zen_thresholds.repmov_stop_threshold = fields[5];
+    zen_info->zen_thresholds.repstore_start_threshold = fields[6];
+    zen_info->zen_thresholds.repstore_stop_threshold = fields[7];
+    zen_info->zen_thresholds.nt_start_threshold = fields[8];
+    return true;
+}
+
+/* Caches the calibrated thresholds, replacing the file atomically
+ * returns: void
+ */
+static inline void calib_store(cpu_info *zen_info, uint64_t key[4], const char *path)
+{
+    char buf[SYSFS_BUF_SZ], tmp_path[SYSFS_PATH_SZ];
+    thresholds *th = &(zen_info->zen_thresholds);
+    int fd, len;
+
+    len = snprintf(buf, SYSFS_BUF_SZ, "0x%lx %lu %lu %lu %lu %lu %lu %lu %lu\n",
+                   key[0], key[1], key[2], key[3], th->repmov_start_threshold,
+                   th->repmov_stop_threshold, th->repstore_start_threshold,
+                   th->repstore_stop_threshold, th->nt_start_threshold);
+
+    if (snprintf(tmp_path, SYSFS_PATH_SZ, "%s.%d", path, getpid()) >= SYSFS_PATH_SZ)
+        return;
+
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        LOG_WARN("Failed to create calibration cache %s\n", tmp_path);
+        return;
+    }
+    if (write(fd, buf, len) != len || close(fd) != 0 || rename(tmp_path, path) != 0)
+    {
+        LOG_WARN("Failed to write calibration cache %s\n", path);
+        unlink(tmp_path);
+    }
+}
+
+/* Measures the thresholds of the host, or loads them from its calibration
+ * cache, replacing the formula values of the system config
+ * returns: void
+ */
+static inline void calibrate_thresholds(cpu_info *zen_info)
+{
+    thresholds *th = &(zen_info->zen_thresholds);
+    char path[SYSFS_PATH_SZ];
+    uint64_t key[4], size;
+    calib_ctx ctx;
+    func_ptr cpy_vec, cpy_nt, set_vec, set_nt;
+    func_ptr cpy_erms = (func_ptr) __memcpy_erms_b_aligned;
+    func_ptr set_erms = (func_ptr) __memset_erms_b_aligned;
+
+    if (zen_info->zen_cpu_features.avx2 != ENABLED)
+        return;
+
+    calib_signature(zen_info, key);
+    calib_file_path(key, path);
+    if (calib_load(zen_info, key, path))
+    {
+        LOG_INFO("Loaded calibrated thresholds from %s\n", path);
+        return;
+    }
+
+    if (zen_info->zen_cpu_features.avx512 == ENABLED)
+    {
+        cpy_vec = (func_ptr) __memcpy_avx512_unaligned;
+        cpy_nt = (func_ptr) __memcpy_avx512_nt_store;
+        set_vec = (func_ptr) __memset_avx512_unaligned;
+        set_nt = (func_ptr) __memset_avx512_nt_store;
+    }
+    else
+    {
+        cpy_vec = (func_ptr) __memcpy_avx2_unaligned;
+        cpy_nt = (func_ptr) __memcpy_avx2_nt_store;
+        set_vec = (func_ptr) __memset_avx2_unaligned;
+        set_nt = (func_ptr) __memset_avx2_nt_store;
+    }
+
+    // buffers fit twice the largest candidate: 4x the formula NT thresholds
+    ctx.buf_sz = 4 * (th->nt_start_threshold > th->repstore_stop_threshold ?
+                      th->nt_start_threshold : th->repstore_stop_threshold);
+    if (ctx.buf_sz > CALIB_BUF_MAX || ctx.buf_sz == 0)
+        ctx.buf_sz = CALIB_BUF_MAX;
+    // pages fault in on the first of the timed repetitions, best of which is kept
+    clock_gettime(CLOCK_MONOTONIC, &ctx.start);
+    ctx.src = mmap(NULL, 2 * ctx.buf_sz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ctx.src == MAP_FAILED)
+        return;
+    ctx.dst = ctx.src + ctx.buf_sz;
+    ctx.budget_exceeded = false;
+
+    if (zen_info->zen_cpu_features.erms == ENABLED)
+    {
+        size = calib_crossover(&ctx, CALIB_MEMCPY, cpy_vec, cpy_erms, 512, 32 * 1024);
+        if (size)
+            th->repmov_start_threshold = size;
+        // the window of rep-movs spans at least a doubling of its start
+        size = calib_crossover(&ctx, CALIB_MEMCPY, cpy_erms, cpy_vec,
+                               2 * th->repmov_start_threshold, 4 * th->repmov_stop_threshold);
+        if (size)
+            th->repmov_stop_threshold = size;
+        size = calib_crossover(&ctx, CALIB_MEMSET, set_vec, set_erms,
+                               th->repstore_start_threshold >> 2, 4 * th->repstore_start_threshold);
+        if (size)
+            th->repstore_start_threshold = size;
+        size = calib_crossover(&ctx, CALIB_MEMSET, set_erms, set_nt,
+                               2 * th->repstore_start_threshold, 4 * th->repstore_stop_threshold);
+        if (size)
+            th->repstore_stop_threshold = size;
+    }
+    size = calib_crossover(&ctx, CALIB_MEMCPY, cpy_vec, cpy_nt,
+                           th->nt_start_threshold >> 2, 4 * th->nt_start_threshold);
+    if (size)
+        th->nt_start_threshold = size;
+
+    munmap(ctx.src, 2 * ctx.buf_sz);
+
+    if (ctx.budget_exceeded)
+    {
+        // partial results are not cached, the next process measures again
+        LOG_INFO("Calibration budget exceeded, remaining thresholds from formulas\n");
+        return;
+    }
+    calib_store(zen_info, key, path);
+    LOG_DEBUG("Calibrated: repmov[%lu, %lu], repstore[%lu, %lu], non_temporal: %lu\n",
+              th->repmov_start_threshold, th->repmov_stop_threshold, th->repstore_start_threshold,
+              th->repstore_stop_threshold, th->nt_start_threshold);
+}
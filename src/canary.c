@@ -0,0 +1,423 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <x86intrin.h>
+#include <sys/mman.h>
+
+/*
+ * Shadow verification (LIBMEM_CANARY=<N>): every function is bound to a
+ * canary entry forwarding to the entry dispatched before. One in N calls
+ * of a thread on average, at jittered intervals, is checked against the
+ * system implementation once it returns: the destination of the copy and
+ * set functions is compared with the source or with the expected bytes,
+ * the result of the compare and search functions with the one of the
+ * __<func>_system implementation. Overlapping memmove calls are checked
+ * on a copy of the source in a scratch buffer of the thread.
+ * Checks and divergences are counted per function, the first divergences
+ * are written to stderr with the size and the 64B alignment of the
+ * buffers, and the counts are reported at exit or on libmem_canary_report().
+ * Functions rebound by libmem_set_variant() or libmem_reload() are bound to
+ * their canary entry again, forwarding to the new entries.
+ */
+
+#define CANARY_SCRATCH_SZ   (64 * 1024)     //largest overlapping memmove checked
+#define CANARY_LOG_MAX      16              //divergences written to stderr
+#define CANARY_LINE_SZ      256
+#define CANARY_BKT(size)    (63 - __builtin_clzl((size) | 1))
+
+static uint32_t canary_rate;                //0 when the verification is off
+static const char * const *canary_func_names;
+static func_ptr canary_impls[FUNC_COUNT][SC_BUCKET_COUNT];
+static uint64_t canary_checks[FUNC_COUNT];
+static uint64_t canary_divergences[FUNC_COUNT];
+static uint64_t canary_logged;
+
+// calls of the thread left before its next check, its random state and scratch buffer
+static __thread uint32_t canary_countdown __attribute__((tls_model("initial-exec")));
+static __thread uint32_t canary_seed __attribute__((tls_model("initial-exec")));
+static __thread uint8_t *canary_scratch __attribute__((tls_model("initial-exec")));
+
+static inline void canary_sample(void)
+{
+    uint32_t rnd = canary_seed;
+
+    if (rnd == 0)
+        rnd = (uint32_t)__rdtsc() | 1;
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    canary_seed = rnd;
+
+    canary_countdown = canary_rate / 2 + rnd % canary_rate;
+}
+
+/* Counts the check of the function, writing the first divergences to stderr
+ * returns: void
+ */
+static inline void canary_verify(func_index idx, bool ok, size_t size,
+                                 const void *dst, const void *src)
+{
+    char line[CANARY_LINE_SZ];
+    ssize_t written;
+    int len;
+
+    __atomic_add_fetch(&canary_checks[idx], 1, __ATOMIC_RELAXED);
+    if (likely(ok))
+        return;
+
+    __atomic_add_fetch(&canary_divergences[idx], 1, __ATOMIC_RELAXED);
+    if (__atomic_add_fetch(&canary_logged, 1, __ATOMIC_RELAXED) > CANARY_LOG_MAX)
+        return;
+    len = snprintf(line, CANARY_LINE_SZ, "libmem canary: %s diverged from the system "
+                   "implementation: size %lu, dst alignment %lu, src alignment %lu\n",
+                   canary_func_names[idx], size, (uintptr_t)dst & (ZMM_SZ - 1),
+                   (uintptr_t)src & (ZMM_SZ - 1));
+    // nothing left to report a failed write to
+    written = write(STDERR_FILENO, line, len);
+    (void) written;
+}
+
+/* Checks every byte of the buffer holds the value
+ * returns: true if so
+ */
+static inline bool canary_bytes_equal(const void *mem, int val, size_t size)
+{
+    const uint8_t *ptr = mem;
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        if (ptr[idx] != (uint8_t)val)
+            return false;
+    }
+    return true;
+}
+
+static inline int canary_sign(int val)
+{
+    return (val > 0) - (val < 0);
+}
+
+/* Maps the scratch buffer of the thread, on its first overlapping memmove check
+ * returns: buffer, NULL on failure
+ */
+static __attribute__((noinline)) uint8_t *canary_thread_scratch(void)
+{
+    uint8_t *scratch;
+
+    scratch = mmap(NULL, CANARY_SCRATCH_SZ, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (scratch == MAP_FAILED)
+        return NULL;
+    canary_scratch = scratch;
+    return scratch;
+}
+
+// Checks of the sampled calls, run after the dispatched entry
+static __attribute__((noinline)) void *canary_check_memcpy(void *dst, const void *src, size_t size)
+{
+    void *ret = ((amd_memcpy_fn) canary_impls[MEMCPY][CANARY_BKT(size)])(dst, src, size);
+
+    canary_verify(MEMCPY, ret == dst && __memcmp_system(dst, src, size) == 0, size, dst, src);
+    return ret;
+}
+
+static __attribute__((noinline)) void *canary_check_mempcpy(void *dst, const void *src, size_t size)
+{
+    void *ret = ((amd_mempcpy_fn) canary_impls[MEMPCPY][CANARY_BKT(size)])(dst, src, size);
+
+    canary_verify(MEMPCPY, ret == (uint8_t *)dst + size && __memcmp_system(dst, src, size) == 0,
+                  size, dst, src);
+    return ret;
+}
+
+static __attribute__((noinline)) void *canary_check_memmove(void *dst, const void *src, size_t size)
+{
+    const uint8_t *ref = src;
+    void *ret;
+
+    // the source of an overlapping move is overwritten, compare with a copy of it
+    if ((uint8_t *)dst < (const uint8_t *)src + size && (const uint8_t *)src < (uint8_t *)dst + size)
+    {
+        ref = canary_scratch;
+        if (size > CANARY_SCRATCH_SZ || (ref == NULL && (ref = canary_thread_scratch()) == NULL))
+            return ((amd_memmove_fn) canary_impls[MEMMOVE][CANARY_BKT(size)])(dst, src, size);
+        __memcpy_system((void *)ref, src, size);
+    }
+
+    ret = ((amd_memmove_fn) canary_impls[MEMMOVE][CANARY_BKT(size)])(dst, src, size);
+    canary_verify(MEMMOVE, ret == dst && __memcmp_system(dst, ref, size) == 0, size, dst, src);
+    return ret;
+}
+
+static __attribute__((noinline)) void *canary_check_memset(void *mem, int val, size_t size)
+{
+    void *ret = ((amd_memset_fn) canary_impls[MEMSET][CANARY_BKT(size)])(mem, val, size);
+
+    canary_verify(MEMSET, ret == mem && canary_bytes_equal(mem, val, size), size, mem, mem);
+    return ret;
+}
+
+static __attribute__((noinline)) int canary_check_memcmp(const void *mem1, const void *mem2, size_t size)
+{
+    int ret = ((amd_memcmp_fn) canary_impls[MEMCMP][0])(mem1, mem2, size);
+
+    canary_verify(MEMCMP, canary_sign(ret) == canary_sign(__memcmp_system(mem1, mem2, size)),
+                  size, mem1, mem2);
+    return ret;
+}
+
+static __attribute__((noinline)) void *canary_check_memchr(const void *mem, int val, size_t size)
+{
+    void *ret = ((amd_memchr_fn) canary_impls[MEMCHR][0])(mem, val, size);
+
+    canary_verify(MEMCHR, ret == __memchr_system(mem, val, size), size, mem, mem);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strcpy(char *dst, const char *src)
+{
+    char *ret = ((amd_strcpy_fn) canary_impls[STRCPY][0])(dst, src);
+    size_t len = __strlen_system(src);
+
+    canary_verify(STRCPY, ret == dst && __memcmp_system(dst, src, len + 1) == 0, len, dst, src);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strncpy(char *dst, const char *src, size_t size)
+{
+    char *ret = ((amd_strncpy_fn) canary_impls[STRNCPY][0])(dst, src, size);
+    size_t len = __strnlen_system(src, size);
+
+    // the source is copied upto the size, the rest of the destination zeroed
+    canary_verify(STRNCPY, ret == dst && __memcmp_system(dst, src, len) == 0
+                  && canary_bytes_equal(dst + len, 0, size - len), size, dst, src);
+    return ret;
+}
+
+static __attribute__((noinline)) int canary_check_strcmp(const char *str1, const char *str2)
+{
+    int ret = ((amd_strcmp_fn) canary_impls[STRCMP][0])(str1, str2);
+
+    canary_verify(STRCMP, canary_sign(ret) == canary_sign(__strcmp_system(str1, str2)),
+                  __strlen_system(str1), str1, str2);
+    return ret;
+}
+
+static __attribute__((noinline)) int canary_check_strncmp(const char *str1, const char *str2,
+                                                          size_t size)
+{
+    int ret = ((amd_strncmp_fn) canary_impls[STRNCMP][0])(str1, str2, size);
+
+    canary_verify(STRNCMP, canary_sign(ret) == canary_sign(__strncmp_system(str1, str2, size)),
+                  size, str1, str2);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strcat(char *dst, const char *src)
+{
+    size_t dst_len = __strlen_system(dst), len;
+    char *ret = ((amd_strcat_fn) canary_impls[STRCAT][0])(dst, src);
+
+    len = __strlen_system(src);
+    canary_verify(STRCAT, ret == dst && __memcmp_system(dst + dst_len, src, len + 1) == 0,
+                  len, dst + dst_len, src);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strncat(char *dst, const char *src, size_t size)
+{
+    size_t dst_len = __strlen_system(dst), len;
+    char *ret = ((amd_strncat_fn) canary_impls[STRNCAT][0])(dst, src, size);
+
+    len = __strnlen_system(src, size);
+    canary_verify(STRNCAT, ret == dst && __memcmp_system(dst + dst_len, src, len) == 0
+                  && dst[dst_len + len] == '\0', size, dst + dst_len, src);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strstr(const char *str, const char *sub)
+{
+    char *ret = ((amd_strstr_fn) canary_impls[STRSTR][0])(str, sub);
+
+    canary_verify(STRSTR, ret == __strstr_system(str, sub), __strlen_system(str), str, sub);
+    return ret;
+}
+
+static __attribute__((noinline)) size_t canary_check_strlen(const char *str)
+{
+    size_t ret = ((amd_strlen_fn) canary_impls[STRLEN][0])(str);
+
+    canary_verify(STRLEN, ret == __strlen_system(str), ret, str, str);
+    return ret;
+}
+
+static __attribute__((noinline)) size_t canary_check_strnlen(const char *str, size_t size)
+{
+    size_t ret = ((amd_strnlen_fn) canary_impls[STRNLEN][0])(str, size);
+
+    canary_verify(STRNLEN, ret == __strnlen_system(str, size), size, str, str);
+    return ret;
+}
+
+static __attribute__((noinline)) char *canary_check_strchr(const char *str, int val)
+{
+    char *ret = ((amd_strchr_fn) canary_impls[STRCHR][0])(str, val);
+
+    canary_verify(STRCHR, ret == __strchr_system(str, val), __strlen_system(str), str, str);
+    return ret;
+}
+
+static __attribute__((noinline)) size_t canary_check_strspn(const char *str, const char *accept)
+{
+    size_t ret = ((amd_strspn_fn) canary_impls[STRSPN][0])(str, accept);
+
+    canary_verify(STRSPN, ret == __strspn_system(str, accept), __strlen_system(str), str, accept);
+    return ret;
+}
+
+/* Canary entry of the function: forwards to the entry of the size bucket of
+ * the call (the first one of the functions dispatched on a single entry),
+ * running the check of the function on the sampled calls
+ */
+#define CANARY_ENTRY(func, FUNC, ret_t, params, args, bkt)          \
+    static ret_t __##func##_canary params                           \
+    {                                                               \
+        if (likely(canary_countdown-- != 0))                        \
+            return ((amd_##func##_fn) canary_impls[FUNC][bkt]) args;\
+        canary_sample();                                            \
+        return canary_check_##func args;                            \
+    }
+
+CANARY_ENTRY(memcpy, MEMCPY, void *, (void *dst, const void *src, size_t size),
+             (dst, src, size), CANARY_BKT(size))
+CANARY_ENTRY(mempcpy, MEMPCPY, void *, (void *dst, const void *src, size_t size),
+             (dst, src, size), CANARY_BKT(size))
+CANARY_ENTRY(memmove, MEMMOVE, void *, (void *dst, const void *src, size_t size),
+             (dst, src, size), CANARY_BKT(size))
+CANARY_ENTRY(memset, MEMSET, void *, (void *mem, int val, size_t size),
+             (mem, val, size), CANARY_BKT(size))
+CANARY_ENTRY(memcmp, MEMCMP, int, (const void *mem1, const void *mem2, size_t size),
+             (mem1, mem2, size), 0)
+CANARY_ENTRY(memchr, MEMCHR, void *, (const void *mem, int val, size_t size),
+             (mem, val, size), 0)
+CANARY_ENTRY(strcpy, STRCPY, char *, (char *dst, const char *src), (dst, src), 0)
+CANARY_ENTRY(strncpy, STRNCPY, char *, (char *dst, const char *src, size_t size),
+             (dst, src, size), 0)
+CANARY_ENTRY(strcmp, STRCMP, int, (const char *str1, const char *str2), (str1, str2), 0)
+CANARY_ENTRY(strncmp, STRNCMP, int, (const char *str1, const char *str2, size_t size),
+             (str1, str2, size), 0)
+CANARY_ENTRY(strcat, STRCAT, char *, (char *dst, const char *src), (dst, src), 0)
+CANARY_ENTRY(strncat, STRNCAT, char *, (char *dst, const char *src, size_t size),
+             (dst, src, size), 0)
+CANARY_ENTRY(strstr, STRSTR, char *, (const char *str, const char *sub), (str, sub), 0)
+CANARY_ENTRY(strlen, STRLEN, size_t, (const char *str), (str), 0)
+CANARY_ENTRY(strnlen, STRNLEN, size_t, (const char *str, size_t size), (str, size), 0)
+CANARY_ENTRY(strchr, STRCHR, char *, (const char *str, int val), (str, val), 0)
+CANARY_ENTRY(strspn, STRSPN, size_t, (const char *str, const char *accept), (str, accept), 0)
+
+static const func_ptr canary_entries[FUNC_COUNT] =
+{
+    [MEMCPY]    = (func_ptr) __memcpy_canary,
+    [MEMPCPY]   = (func_ptr) __mempcpy_canary,
+    [MEMMOVE]   = (func_ptr) __memmove_canary,
+    [MEMSET]    = (func_ptr) __memset_canary,
+    [MEMCMP]    = (func_ptr) __memcmp_canary,
+    [MEMCHR]    = (func_ptr) __memchr_canary,
+    [STRCPY]    = (func_ptr) __strcpy_canary,
+    [STRNCPY]   = (func_ptr) __strncpy_canary,
+    [STRCMP]    = (func_ptr) __strcmp_canary,
+    [STRNCMP]   = (func_ptr) __strncmp_canary,
+    [STRCAT]    = (func_ptr) __strcat_canary,
+    [STRNCAT]   = (func_ptr) __strncat_canary,
+    [STRSTR]    = (func_ptr) __strstr_canary,
+    [STRLEN]    = (func_ptr) __strlen_canary,
+    [STRNLEN]   = (func_ptr) __strnlen_canary,
+    [STRCHR]    = (func_ptr) __strchr_canary,
+    [STRSPN]    = (func_ptr) __strspn_canary,
+};
+
+/* Entry the calls of the bucket are checked against, seen through the canary entry
+ * returns: function pointer
+ */
+static inline func_ptr canary_unwrap(func_index idx, func_ptr impl)
+{
+    if (canary_rate != 0 && impl == canary_entries[idx])
+        return canary_impls[idx][(idx < SC_FUNC_COUNT) ? SC_BUCKET_COUNT - 1 : 0];
+    return impl;
+}
+
+/* Writes the checked calls and the divergences of every function
+ * returns: 0 on success, -1 without verification or on write failure
+ */
+static inline int canary_report(int fd)
+{
+    char line[CANARY_LINE_SZ];
+    int len;
+
+    if (canary_rate == 0)
+        return -1;
+
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+    {
+        len = snprintf(line, CANARY_LINE_SZ, "libmem canary: %-8s %12lu checked %8lu diverged\n",
+                       canary_func_names[idx], __atomic_load_n(&canary_checks[idx], __ATOMIC_RELAXED),
+                       __atomic_load_n(&canary_divergences[idx], __ATOMIC_RELAXED));
+        if (write(fd, line, len) != len)
+            return -1;
+    }
+    return 0;
+}
+
+/* Binds the function to its canary entry, forwarding to the entries it is
+ * dispatched to
+ * returns: void
+ */
+static inline void canary_bind(func_index idx)
+{
+    size_t buckets = (idx < SC_FUNC_COUNT) ? SC_BUCKET_COUNT : 1;
+
+    for (size_t bkt = 0; bkt < buckets; bkt++)
+        canary_impls[idx][bkt] = libmem_dispatch_slots[idx][bkt];
+    for (size_t bkt = 0; bkt < buckets; bkt++)
+        __atomic_store_n(&libmem_dispatch_slots[idx][bkt], canary_entries[idx], __ATOMIC_RELEASE);
+}
+
+/* Binds every function to its canary entry, checking one in rate calls
+ * returns: void
+ */
+static inline void configure_canary(uint32_t rate, const char * const *func_names)
+{
+    canary_func_names = func_names;
+    canary_rate = rate;
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+        canary_bind(idx);
+    LOG_INFO("Canary checks one in %u calls against the system implementations\n", rate);
+}
+
+static __attribute__((destructor)) void canary_fini(void)
+{
+    if (canary_rate != 0)
+        canary_report(STDERR_FILENO);
+}
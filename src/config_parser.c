@@ -0,0 +1,251 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include "logger.h"
+#include "zen_cpu_info.h"
+
+/*
+ * Config file of the tunables (LIBMEM_CONFIG, /etc/libmem.conf by default):
+ * INI-like sections of KEY=VALUE lines, the keys being the names of the
+ * LIBMEM_* environment variables. The keys of [default] apply to every
+ * process, [exe:<name>] to the executable of that name (full path if the
+ * name has a '/'), [cgroup:<path>] to the processes of that cgroup or of
+ * one below it. The file is kept in a static buffer the looked up values
+ * point into, as it is read from the library constructor.
+ */
+
+#define CONFIG_BUF_SZ       16384
+#define CONFIG_MAX_ENTRIES  256
+#define PROC_SELF_EXE       "/proc/self/exe"
+#define PROC_SELF_CGROUP    "/proc/self/cgroup"
+#define CGROUP_BUF_SZ       4096
+
+typedef struct {
+    const char *key;
+    const char *value;
+} config_entry;
+
+static char config_buf[CONFIG_BUF_SZ];
+static config_entry config_entries[CONFIG_MAX_ENTRIES];
+static unsigned int config_entry_count;
+
+/* Reads the whole file as a NUL terminated string
+ * returns: bytes read, -1 on failure
+ */
+static inline ssize_t read_config_file(const char *path, char *buf, size_t size)
+{
+    ssize_t bytes, total = 0;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+
+    while ((size_t)total < size - 1)
+    {
+        bytes = read(fd, buf + total, size - 1 - total);
+        if (bytes <= 0)
+            break;
+        total += bytes;
+    }
+    close(fd);
+
+    buf[total] = '\0';
+    return total;
+}
+
+/* Strips the leading and trailing blanks of the string in place
+ * returns: stripped string
+ */
+static inline char *strip_blanks(char *str)
+{
+    char *end;
+
+    while (*str == ' ' || *str == '\t')
+        str++;
+    end = str + strlen(str);
+    while (end > str && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r'))
+        *--end = '\0';
+    return str;
+}
+
+/* Matches the executable name, against the full path if the name has a '/'
+ * returns: true on match
+ */
+static inline bool config_exe_matches(const char *name)
+{
+    char exe[PATH_MAX];
+    const char *base;
+    ssize_t len;
+
+    len = readlink(PROC_SELF_EXE, exe, sizeof(exe) - 1);
+    if (len <= 0)
+        return false;
+    exe[len] = '\0';
+
+    if (strchr(name, '/') != NULL)
+        return !strcmp(name, exe);
+
+    base = strrchr(exe, '/');
+    return !strcmp(name, base != NULL ? base + 1 : exe);
+}
+
+/* Matches the cgroup path against the cgroups of the process on any
+ * hierarchy, a cgroup below the path matching too
+ * returns: true on match
+ */
+static inline bool config_cgroup_matches(const char *path)
+{
+    char buf[CGROUP_BUF_SZ];
+    char *line, *next, *cgroup;
+    size_t len = strlen(path);
+
+    // the root cgroup matches every process
+    while (len > 0 && path[len - 1] == '/')
+        len--;
+
+    if (read_config_file(PROC_SELF_CGROUP, buf, sizeof(buf)) <= 0)
+        return false;
+
+    for (line = buf; line != NULL && *line; line = next)
+    {
+        next = strchr(line, '\n');
+        if (next != NULL)
+            *next++ = '\0';
+
+        // <hierarchy-id>:<controllers>:<path>
+        cgroup = strchr(line, ':');
+        if (cgroup == NULL || (cgroup = strchr(cgroup + 1, ':')) == NULL)
+            continue;
+        cgroup++;
+
+        if (!strncmp(cgroup, path, len) && (cgroup[len] == '\0' || cgroup[len] == '/'))
+            return true;
+    }
+    return false;
+}
+
+/* Matches the section header against the process
+ * returns: true if the keys of the section apply
+ */
+static inline bool config_section_matches(const char *section)
+{
+    if (!strcmp(section, "default"))
+        return true;
+    if (!strncmp(section, "exe:", 4))
+        return config_exe_matches(section + 4);
+    if (!strncmp(section, "cgroup:", 7))
+        return config_cgroup_matches(section + 7);
+
+    LOG_WARN("Unknown config section: [%s]\n", section);
+    return false;
+}
+
+void parse_config_file(const char *path)
+{
+    char *line, *next, *section;
+    bool active = true;     //keys ahead of any section apply to every process
+    unsigned int line_no = 0;
+    ssize_t bytes;
+
+    // a reload drops the keys of the file read earlier
+    config_entry_count = 0;
+    bytes = read_config_file(path, config_buf, CONFIG_BUF_SZ);
+    if (bytes < 0)
+    {
+        LOG_DEBUG("Config file %s is not readable.\n", path);
+        return;
+    }
+    LOG_INFO("Config file: %s\n", path);
+    if (bytes == CONFIG_BUF_SZ - 1)
+        LOG_WARN("Config file %s is truncated to %d bytes.\n", path, CONFIG_BUF_SZ - 1);
+
+    for (line = config_buf; line != NULL && *line; line = next)
+    {
+        char *value, *end;
+
+        line_no++;
+        next = strchr(line, '\n');
+        if (next != NULL)
+            *next++ = '\0';
+
+        line = strip_blanks(line);
+        if (*line == '\0' || *line == '#' || *line == ';')
+            continue;
+
+        if (*line == '[')
+        {
+            end = strchr(line, ']');
+            if (end == NULL || end[1] != '\0')
+            {
+                LOG_WARN("%s:%u: invalid section header.\n", path, line_no);
+                active = false;
+                continue;
+            }
+            *end = '\0';
+            section = strip_blanks(line + 1);
+            active = config_section_matches(section);
+            LOG_DEBUG("%s:%u: section [%s] %s.\n", path, line_no, section,
+                        active ? "matches" : "does not match");
+            continue;
+        }
+
+        value = strchr(line, '=');
+        if (value == NULL)
+        {
+            LOG_WARN("%s:%u: expected KEY=VALUE.\n", path, line_no);
+            continue;
+        }
+        *value++ = '\0';
+
+        if (!active)
+            continue;
+
+        if (config_entry_count == CONFIG_MAX_ENTRIES)
+        {
+            LOG_WARN("%s:%u: more than %d keys, ignoring the rest.\n", path, line_no,
+                        CONFIG_MAX_ENTRIES);
+            return;
+        }
+        config_entries[config_entry_count].key = strip_blanks(line);
+        config_entries[config_entry_count].value = strip_blanks(value);
+        config_entry_count++;
+    }
+}
+
+const char *config_getenv(const char *name)
+{
+    // keys of later sections override the earlier ones
+    for (unsigned int idx = config_entry_count; idx-- > 0;)
+    {
+        if (!strcmp(config_entries[idx].key, name))
+            return config_entries[idx].value;
+    }
+    return NULL;
+}
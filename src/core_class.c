@@ -0,0 +1,158 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Core classes of mixed systems: parts pairing classic and dense cores
+ * report the same CPUID family/model on every core, but their CCXs differ
+ * in L3 size and core count. The CPUs are grouped by the size and sharing
+ * of their L3 from the sysfs cache topology, each group getting its own
+ * L3 sized thresholds, looked up per call through __cpu_core_class.
+ */
+
+#define CPU_SYSFS_DIR       "/sys/devices/system/cpu"
+#define CORE_CLASS_UNSET    0xff
+
+typedef struct {
+    uint64_t l3_size;
+    unsigned int threads;
+} core_class_key;
+
+/* Parses a sysfs cache size such as "32768K"
+ * returns: size in Bytes
+ */
+static inline uint64_t parse_cache_size(const char *cache_size)
+{
+    char *end;
+    uint64_t size = strtoull(cache_size, &end, 10);
+
+    if (*end == 'K')
+        size <<= 10;
+    else if (*end == 'M')
+        size <<= 20;
+    return size;
+}
+
+/* Looks up the class of the L3, adding it if new
+ * returns: class index, CORE_CLASS_UNSET if all the classes are in use
+ */
+static inline uint8_t get_core_class(core_class_key *keys, unsigned int *class_count,
+                                     uint64_t l3_size, unsigned int threads)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < *class_count; idx++)
+    {
+        if (keys[idx].l3_size == l3_size && keys[idx].threads == threads)
+            return idx;
+    }
+    if (idx == CORE_CLASS_MAX)
+        return CORE_CLASS_UNSET;
+
+    keys[idx].l3_size = l3_size;
+    keys[idx].threads = threads;
+    (*class_count)++;
+    return idx;
+}
+
+/* Groups the CPUs into core classes and computes the thresholds of each.
+ * Systems with a single class, without RDPID or with an unreadable topology
+ * keep the global thresholds.
+ * returns: void
+ */
+static inline void configure_core_classes(cpu_info *zen_info)
+{
+    char buf[SYSFS_BUF_SZ], path[SYSFS_PATH_SZ];
+    core_class_key keys[CORE_CLASS_MAX];
+    unsigned int cpus, class_count = 0;
+    const char *root = get_sysfs_root();
+
+    if (zen_info->zen_cpu_features.rdpid != ENABLED)
+        return;
+
+    if (read_sysfs_file(root, CPU_SYSFS_DIR "/possible", buf) <= 0)
+        return;
+    cpus = parse_cpu_list(buf, NULL, 0, 0);
+    if (cpus == 0 || cpus > CORE_CLASS_CPU_MAX)
+        return;
+
+    memset(__cpu_core_class, CORE_CLASS_UNSET, sizeof(__cpu_core_class));
+    for (unsigned int cpu = 0; cpu < cpus; cpu++)
+    {
+        uint64_t l3_size;
+        uint8_t class_idx;
+
+        if (__cpu_core_class[cpu] != CORE_CLASS_UNSET)
+            continue;
+
+        // offline CPUs expose no cache topology, left to the first class
+        snprintf(path, SYSFS_PATH_SZ, CPU_SYSFS_DIR "/cpu%u/cache/index3/size", cpu);
+        if (read_sysfs_file(root, path, buf) <= 0)
+            continue;
+        l3_size = parse_cache_size(buf);
+
+        snprintf(path, SYSFS_PATH_SZ, CPU_SYSFS_DIR "/cpu%u/cache/index3/shared_cpu_list", cpu);
+        if (read_sysfs_file(root, path, buf) <= 0)
+            continue;
+
+        class_idx = get_core_class(keys, &class_count, l3_size, parse_cpu_list(buf, NULL, 0, 0));
+        if (class_idx == CORE_CLASS_UNSET)
+        {
+            LOG_WARN("More than %d core classes, using global thresholds\n", CORE_CLASS_MAX);
+            memset(__cpu_core_class, 0, sizeof(__cpu_core_class));
+            return;
+        }
+        parse_cpu_list(buf, __cpu_core_class, CORE_CLASS_CPU_MAX, class_idx);
+    }
+
+    for (unsigned int cpu = 0; cpu < CORE_CLASS_CPU_MAX; cpu++)
+    {
+        if (__cpu_core_class[cpu] == CORE_CLASS_UNSET)
+            __cpu_core_class[cpu] = 0;
+    }
+
+    if (class_count <= 1)
+        return;
+
+    for (unsigned int idx = 0; idx < class_count; idx++)
+    {
+        uint64_t l3_budget = keys[idx].l3_size;
+
+        // resctrl L3 CAT grants the same share of the ways on every L3
+        if (zen_info->zen_cache_info.l3_per_ccx != 0)
+            l3_budget = l3_budget * zen_info->zen_cache_budget.l3_per_ccx
+                                  / zen_info->zen_cache_info.l3_per_ccx;
+
+        __core_class_thresholds[idx].nt_start_threshold =
+                compute_nt_start_threshold(zen_info, l3_budget, keys[idx].threads);
+        __core_class_thresholds[idx].repstore_stop_threshold =
+                compute_repstore_stop_threshold(zen_info, l3_budget);
+
+        LOG_DEBUG("Core class %u: L3/CCX: %lu, Threads/CCX: %u, non_temporal: %lu, repstore_stop: %lu\n",
+                  idx, keys[idx].l3_size, keys[idx].threads,
+                  __core_class_thresholds[idx].nt_start_threshold,
+                  __core_class_thresholds[idx].repstore_stop_threshold);
+    }
+    __atomic_store_n(&__core_class_count, class_count, __ATOMIC_RELEASE);
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -22,10 +22,13 @@
  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  * POSSIBILITY OF SUCH DAMAGE.
  */
+#include <stddef.h>
 #include "zen_cpu_info.h"
 
 HIDDEN_SYMBOL cpu_info zen_info;
 
+extern char **_dl_argv;
+
 static inline void __get_cpu_features(cpuid_registers *cpuid_regs)
 {
     asm volatile
@@ -36,20 +39,37 @@ static inline void __get_cpu_features(cpuid_registers *cpuid_regs)
     );
 }
 
-static inline bool is_amd()
+/* CPU vendor from the CPUID 0 signature
+ * returns: vendor
+ */
+static inline cpu_vendor get_cpu_vendor()
 {
     cpuid_registers cpuid_regs;
 
     cpuid_regs.eax= 0x0;
     cpuid_regs.ecx = 0;
     __get_cpu_features(&cpuid_regs);
-    if ((cpuid_regs.ebx ^ 0x68747541) |
-            (cpuid_regs.edx ^ 0x69746E65) |
-                 (cpuid_regs.ecx ^ 0x444D4163))
-    {
-        return false;
-    }
-    return true;
+    if (!((cpuid_regs.ebx ^ AMD_VENDOR_EBX) |
+            (cpuid_regs.edx ^ AMD_VENDOR_EDX) |
+                 (cpuid_regs.ecx ^ AMD_VENDOR_ECX)))
+        return AMD_VENDOR;
+    if (!((cpuid_regs.ebx ^ HYGON_VENDOR_EBX) |
+            (cpuid_regs.edx ^ HYGON_VENDOR_EDX) |
+                 (cpuid_regs.ecx ^ HYGON_VENDOR_ECX)))
+        return HYGON_VENDOR;
+    if (!((cpuid_regs.ebx ^ INTEL_VENDOR_EBX) |
+            (cpuid_regs.edx ^ INTEL_VENDOR_EDX) |
+                 (cpuid_regs.ecx ^ INTEL_VENDOR_ECX)))
+        return INTEL_VENDOR;
+    return OTHER_VENDOR;
+}
+
+/* AMD and Hygon CPUs share the CPUID cache leaves and the Zen tuning
+ * returns: true for AMD and Hygon vendors
+ */
+static inline bool is_amd_vendor(cpu_vendor vendor)
+{
+    return (vendor == AMD_VENDOR) || (vendor == HYGON_VENDOR);
 }
 
 static inline void get_cpu_capabilities()
@@ -60,12 +80,15 @@ static inline void get_cpu_capabilities()
     cpuid_regs.ecx = 0;
     __get_cpu_features(&cpuid_regs);
 
-    if (cpuid_regs.ebx & AVX512_MASK)
+    // the AVX512 kernels are built with the BW, VL and VBMI subsets
+    if (((cpuid_regs.ebx & AVX512_KERNEL_EBX_MASK) == AVX512_KERNEL_EBX_MASK) &&
+            (cpuid_regs.ecx & AVX512_KERNEL_ECX_MASK))
     {
         zen_info.zen_cpu_features.avx512 = ENABLED;
         LOG_INFO("CPU feature AVX512 Enabled\n");
     }
-    if (cpuid_regs.ebx & AVX2_MASK)
+    // the AVX2 kernels are built with BMI2
+    if ((cpuid_regs.ebx & AVX2_MASK) && (cpuid_regs.ebx & BMI2_MASK))
     {
         zen_info.zen_cpu_features.avx2 = ENABLED;
         LOG_INFO("CPU feature AVX2 Enabled\n");
@@ -95,9 +118,87 @@ static inline void get_cpu_capabilities()
         zen_info.zen_cpu_features.rdpid = ENABLED;
         LOG_INFO("CPU feature RDPID Enabled\n");
     }
-    if (cpuid_regs.ecx & RDSEED_MASK)
+    if (cpuid_regs.ebx & RDSEED_MASK)
     {
         zen_info.zen_cpu_features.rdseed = ENABLED;
         LOG_INFO("CPU feature RDSEED Enabled\n");
     }
 }
+
+/* Value of an environment variable, read from the process arguments block without libc:
+ * the IFUNC resolvers run before libc is initialized
+ * returns: value, NULL if unset
+ */
+static inline const char *get_env_early(const char *name)
+{
+    int argc;
+    char **env;
+
+    if (_dl_argv == NULL)
+        return NULL;
+    argc = *(int*)(_dl_argv - 1);
+    for (env = _dl_argv + argc + 1; *env != NULL; env++)
+    {
+        const char *var = *env, *key = name;
+
+        while (*key && *var == *key)
+        {
+            var++;
+            key++;
+        }
+        if (*key == '\0' && *var == '=')
+            return var + 1;
+    }
+    return NULL;
+}
+
+/* Zen generation forced by LIBMEM_ARCH=zen1..zen5
+ * returns: microarch, UARCH_UNKNOWN if unset or invalid
+ */
+static inline microarch get_arch_override(void)
+{
+    const char *arch = get_env_early("LIBMEM_ARCH");
+
+    if (arch == NULL || arch[0] != 'z' || arch[1] != 'e' || arch[2] != 'n')
+        return UARCH_UNKNOWN;
+    if (arch[3] < '0' + ZEN1 || arch[3] > '0' + ZEN5 || arch[4] != '\0')
+        return UARCH_UNKNOWN;
+    return (microarch)(arch[3] - '0');
+}
+
+/* Zen generation whose kernels fit the CPU: LIBMEM_ARCH, else the family/model table of
+ * AMD and Hygon CPUs, else the feature bits; lowered to the ISA the CPU exposes.
+ * Other vendors get the kernels of their widest vector ISA.
+ * Free of libc and of zen_info: called from the IFUNC resolvers.
+ * returns: microarch, UARCH_UNKNOWN for the system implementations
+ */
+static inline microarch get_cpu_uarch(void)
+{
+    cpuid_registers cpuid_regs;
+    uint32_t ebx7, ecx7, family;
+    microarch uarch;
+
+    cpuid_regs.eax = 0x7;
+    cpuid_regs.ecx = 0;
+    __get_cpu_features(&cpuid_regs);
+    ebx7 = cpuid_regs.ebx;
+    ecx7 = cpuid_regs.ecx;
+
+    uarch = get_arch_override();
+    if (uarch == UARCH_UNKNOWN && !is_amd_vendor(get_cpu_vendor()))
+        uarch = ZEN4;
+    else if (uarch == UARCH_UNKNOWN)
+    {
+        cpuid_regs.eax = 0x1;
+        cpuid_regs.ecx = 0;
+        __get_cpu_features(&cpuid_regs);
+        family = CPUID_FAMILY(cpuid_regs.eax);
+        uarch = zen_uarch_from_model(family, CPUID_MODEL(cpuid_regs.eax));
+        // families beyond the table run the latest kernels
+        if (uarch == UARCH_UNKNOWN && family > ZEN5_FAMILY)
+            uarch = ZEN5;
+        else if (uarch == UARCH_UNKNOWN)
+            uarch = zen_uarch_from_features(ebx7, ecx7);
+    }
+    return zen_uarch_supported(uarch, ebx7, ecx7);
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -25,13 +25,33 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "logger.h"
 #include "zen_cpu_info.h"
+#include "libmem_api.h"
 
 extern config active_operation_cfg;
 extern config active_threshold_cfg;
 HIDDEN_SYMBOL user_cfg user_config;
 
+// Environment variables of the threshold blocks and of the per-function variants,
+// also read by the IFUNC resolvers
+HIDDEN_SYMBOL const char * const threshold_envs[TH_BLOCK_COUNT] =
+{
+    [TH_MEMCPY] = "LIBMEM_MEMCPY_THRESHOLD", [TH_MEMMOVE] = "LIBMEM_MEMMOVE_THRESHOLD",
+    [TH_MEMSET] = "LIBMEM_MEMSET_THRESHOLD", [TH_ALL] = "LIBMEM_THRESHOLD"
+};
+
+HIDDEN_SYMBOL const char * const variant_envs[LIBMEM_FUNC_COUNT] =
+{
+    "LIBMEM_MEMCPY_VARIANT", "LIBMEM_MEMPCPY_VARIANT", "LIBMEM_MEMMOVE_VARIANT",
+    "LIBMEM_MEMSET_VARIANT", "LIBMEM_MEMCMP_VARIANT", "LIBMEM_MEMCHR_VARIANT",
+    "LIBMEM_STRCPY_VARIANT", "LIBMEM_STRNCPY_VARIANT", "LIBMEM_STRCMP_VARIANT",
+    "LIBMEM_STRNCMP_VARIANT", "LIBMEM_STRCAT_VARIANT", "LIBMEM_STRNCAT_VARIANT",
+    "LIBMEM_STRSTR_VARIANT", "LIBMEM_STRLEN_VARIANT", "LIBMEM_STRNLEN_VARIANT",
+    "LIBMEM_STRCHR_VARIANT", "LIBMEM_STRSPN_VARIANT"
+};
+
 extern char **environ;
 extern char **_dl_argv;
 
@@ -41,18 +61,106 @@ static inline char ** get_environ() {
     return my_environ;
 }
 
-static inline int string_compare(char *str1, char *str2)
+static inline int string_compare(const char *str1, const char *str2)
 {
 	while(*str1 && *(str1++) == *(str2++));
 	return (*(unsigned char *)str1 - *(unsigned char *)str2);
 }
 
-void parse_env_operation_cfg(void)
+/* Value of the tunable: the environment variable, else the key of the
+ * config file profiles matching the process
+ * returns: value, NULL if unset
+ */
+static inline const char *libmem_getenv(const char *name)
+{
+    const char *value = getenv(name);
+
+    return (value != NULL) ? value : config_getenv(name);
+}
+
+/* Compares the string with the token ending at the separator or at the end
+ * of the token string
+ * returns: 0 if equal
+ */
+static inline int token_compare(const char *token, char sep, const char *str)
+{
+    while (*token && *token != sep && *token == *str)
+    {
+        token++;
+        str++;
+    }
+    return (*token == sep || *token == '\0') ? *str : 1;
+}
+
+static inline alignment parse_alignment(char aln)
+{
+    //invalid input is considered as unaligned.
+    return (aln=='w')?w_align:(aln=='d')?d_align: \
+           (aln=='q')?q_align:(aln=='x')?x_align: \
+           (aln=='y')?y_align:(aln=='n')?n_align: \
+           u_align;
+}
+
+void parse_env_config_cfg(void)
 {
-    char * user_operation_cfgs, *token;
+    const char *config_file;
     environ = get_environ();
 
-    user_operation_cfgs = getenv("LIBMEM_OPERATION");
+    // the IFUNC resolvers bound the functions before the file could be read
+    if (user_config.direct_bind)
+    {
+        LOG_INFO("LIBMEM_DIRECT_BIND: config file not read\n");
+        return;
+    }
+
+    // the config file path is not looked up in the config file itself
+    config_file = getenv("LIBMEM_CONFIG");
+    if (config_file == NULL)
+    {
+        LOG_DEBUG("Environment variable LIBMEM_CONFIG is not set.\n");
+        config_file = LIBMEM_CONFIG_FILE;
+    }
+    parse_config_file(config_file);
+}
+
+/* Parses <operation>,<src_alignment>,<dst_alignment> in place, the value points
+ * into the environment. Free of libc: called from the IFUNC resolvers.
+ * returns: 0 on success, -1 on invalid operation or alignments
+ */
+int parse_operation_value(const char *value, cpu_operation *op, alignment *src_aln,
+                          alignment *dst_aln)
+{
+    const char *aln = value;
+
+    *op = (cpu_operation){0};
+    if (!token_compare(value, ',', "avx512"))
+        op->avx512 = 1;
+    else if (!token_compare(value, ',', "avx2"))
+        op->avx2 = 1;
+    else if (!token_compare(value, ',', "erms"))
+        op->erms = 1;
+    else
+        return -1;
+
+    while (*aln && *aln != ',')
+        aln++;
+    if (*aln == '\0' || *++aln == '\0' || *aln == ',')
+        return -1;
+    *src_aln = parse_alignment(*aln);
+
+    while (*aln && *aln != ',')
+        aln++;
+    if (*aln == '\0' || *++aln == '\0' || *aln == ':')
+        return -1;
+    *dst_aln = parse_alignment(*aln);
+    return 0;
+}
+
+void parse_env_operation_cfg(void)
+{
+    const char *user_operation_cfgs;
+
+    user_operation_cfgs = libmem_getenv("LIBMEM_OPERATION");
     if (user_operation_cfgs == NULL)
     {
         LOG_DEBUG("Environment variable LIBMEM_OPERATION is not set.\n");
@@ -60,95 +168,313 @@ void parse_env_operation_cfg(void)
     }
     LOG_DEBUG("LIBMEM_OPERATION: %s\n", user_operation_cfgs);
 
-    token = strtok(user_operation_cfgs,",");
-
-    if (token == NULL)
+    if (parse_operation_value(user_operation_cfgs, &user_config.user_operation,
+                              &user_config.src_aln, &user_config.dst_aln) != 0)
     {
-        LOG_WARN("Failed to parse <CPU_OPERATION>\n");
+        user_config.user_operation = (cpu_operation){0};
+        LOG_WARN("invalid CPU operation: %s\n", user_operation_cfgs);
         return;
     }
 
-    if (!string_compare(token, "avx512"))
-        user_config.user_operation.avx512 = 1;
-    else if (!string_compare(token, "avx2"))
-        user_config.user_operation.avx2 = 1;
-    else if (!string_compare(token, "erms"))
-        user_config.user_operation.erms = 1;
+    active_operation_cfg = USR_CFG;
+}
+
+/* Parses an unsigned number in decimal, octal with a leading 0 or hex with a
+ * leading 0x, as strtoull() with base 0 does
+ * returns: 0 on success, -1 without digits or on overflow
+ */
+static inline int parse_number(const char **str, uint64_t *val)
+{
+    const char *ptr = *str;
+    unsigned int base = 10, digit;
+
+    if (ptr[0] == '0' && (ptr[1] == 'x' || ptr[1] == 'X'))
+    {
+        base = 16;
+        ptr += 2;
+    }
+    else if (ptr[0] == '0')
+        base = 8;
+
+    for (*val = 0; ; ptr++)
+    {
+        if (*ptr >= '0' && *ptr <= '9')
+            digit = *ptr - '0';
+        else if ((*ptr | 0x20) >= 'a' && (*ptr | 0x20) <= 'f')
+            digit = (*ptr | 0x20) - 'a' + 10;
+        else
+            break;
+        if (digit >= base)
+            break;
+        if (*val > (UINT64_MAX - digit) / base)
+            return -1;
+        *val = *val * base + digit;
+    }
+    if (ptr == *str || (base == 16 && ptr == *str + 2))
+        return -1;
+    *str = ptr;
+    return 0;
+}
+
+/* Parses a threshold in Bytes with an optional K/M/G unit suffix, or -1 for the
+ * maximum length, followed by the separator or the end of the string
+ * returns: 0 on success, -1 on invalid threshold
+ */
+static inline int parse_threshold_value(const char **str, char sep, uint64_t *val)
+{
+    const char *end = *str;
+    unsigned int shift = 0;
+
+    if (end[0] == '-' && end[1] == '1')
+    {
+        *val = UINT64_MAX;
+        end += 2;
+    }
+    else if (parse_number(&end, val) == 0)
+    {
+        switch (*end)
+        {
+            case 'K': case 'k': shift = 10; end++; break;
+            case 'M': case 'm': shift = 20; end++; break;
+            case 'G': case 'g': shift = 30; end++; break;
+        }
+    }
     else
+        return -1;
+
+    if (*end != sep || *val > (UINT64_MAX >> shift))
+        return -1;
+
+    *val <<= shift;
+    *str = (*end == '\0') ? end : end + 1;
+    return 0;
+}
+
+/* Parses a threshold block <rep_start>,<rep_stop>,<nt_start>,<nt_stop>: rep-movs
+ * bounds of the move blocks, rep-stores bounds of the memset block.
+ * Free of libc: called from the IFUNC resolvers.
+ * returns: 0 on success, -1 on invalid thresholds
+ */
+int parse_threshold_block_value(const char *value, threshold_block blk, thresholds *th)
+{
+    uint64_t val[4];
+
+    for (int idx = 0; idx < 4; idx++)
     {
-        LOG_WARN("invalid CPU operation: %s\n", token);
+        if (parse_threshold_value(&value, idx < 3 ? ',' : '\0', &val[idx]) != 0)
+            return -1;
+    }
+    // a start threshold exceeding its stop threshold
+    if (val[0] > val[1] || val[2] > val[3])
+        return -1;
+
+    if (blk == TH_MEMSET)
+    {
+        th->repstore_start_threshold = val[0];
+        th->repstore_stop_threshold = val[1];
+    }
+    else
+    {
+        th->repmov_start_threshold = val[0];
+        th->repmov_stop_threshold = val[1];
+    }
+    th->nt_start_threshold = val[2];
+    th->nt_stop_threshold = val[3];
+    return 0;
+}
+
+static inline void parse_env_threshold_block(threshold_block blk)
+{
+    const char *user_threshold_cfg;
+
+    user_threshold_cfg = libmem_getenv(threshold_envs[blk]);
+    if (user_threshold_cfg == NULL)
+    {
+        LOG_DEBUG("Environment variable %s is not set.\n", threshold_envs[blk]);
         return;
     }
+    LOG_DEBUG("%s: %s\n", threshold_envs[blk], user_threshold_cfg);
 
-    token = (char *)strtok(NULL, ",");
-    if(token == NULL)
+    if (parse_threshold_block_value(user_threshold_cfg, blk,
+                                    &user_config.user_threshold[blk]) != 0)
     {
-        LOG_WARN("Failed to parse <SRC_ALIGNMENT>.\n");
+        LOG_WARN("invalid %s: %s\n", threshold_envs[blk], user_threshold_cfg);
         return;
     }
-    //invalid input is considered as unaligned.
-    user_config.src_aln = (*token=='w')?w_align:(*token=='d')?d_align: \
-                  (*token=='q')?q_align:(*token=='x')?x_align: \
-                  (*token=='y')?y_align:(*token=='n')?n_align: \
-                  u_align;
 
-    token = (char *)strtok(NULL, ":");
+    user_config.user_threshold_blocks |= 1U << blk;
+    active_threshold_cfg = USR_CFG;
+}
+
+void parse_env_threshold_cfg(void)
+{
+    parse_env_threshold_block(TH_ALL);
+    parse_env_threshold_block(TH_MEMCPY);
+    parse_env_threshold_block(TH_MEMMOVE);
+    parse_env_threshold_block(TH_MEMSET);
+}
+
+void parse_env_l3_sharing_cfg(void)
+{
+    const char * user_l3_sharing_cfg;
 
-    if(token == NULL)
+    user_l3_sharing_cfg = libmem_getenv("LIBMEM_L3_SHARING");
+    if (user_l3_sharing_cfg == NULL)
     {
-        LOG_WARN("Failed to parse <DST_ALIGNMENT>.\n");
+        LOG_DEBUG("Environment variable LIBMEM_L3_SHARING is not set.\n");
         return;
     }
-    //invalid input is considered as unaligned.
-    user_config.dst_aln = (*token=='w')?w_align:(*token=='d')?d_align: \
-                  (*token=='q')?q_align:(*token=='x')?x_align: \
-                  (*token=='y')?y_align:(*token=='n')?n_align: \
-                  u_align;
 
-    active_operation_cfg = USR_CFG;
+    if (!string_compare(user_l3_sharing_cfg, "ccx"))
+        user_config.l3_share = CCX_SHARE;
+    else if (!string_compare(user_l3_sharing_cfg, "affinity"))
+        user_config.l3_share = AFFINITY_SHARE;
+    else if (!string_compare(user_l3_sharing_cfg, "none"))
+        user_config.l3_share = NO_SHARE;
+    else
+        LOG_WARN("invalid L3 sharing: %s\n", user_l3_sharing_cfg);
 }
 
-void parse_env_threshold_cfg(void)
+void parse_env_sysfs_root_cfg(void)
 {
-    char * user_threshold_cfg, *token;
+    user_config.sysfs_root = libmem_getenv("LIBMEM_SYSFS_ROOT");
+    if (user_config.sysfs_root == NULL)
+        LOG_DEBUG("Environment variable LIBMEM_SYSFS_ROOT is not set.\n");
+}
 
-    user_threshold_cfg = getenv("LIBMEM_THRESHOLD");
-    if (user_threshold_cfg == NULL)
+void parse_env_calibrate_cfg(void)
+{
+    const char * user_calibrate_cfg;
+
+    user_calibrate_cfg = libmem_getenv("LIBMEM_CALIBRATE");
+    if (user_calibrate_cfg == NULL)
     {
-        LOG_DEBUG("Environment variable LIBMEM_THRESHOLD is not set.\n");
+        LOG_DEBUG("Environment variable LIBMEM_CALIBRATE is not set.\n");
         return;
     }
+    user_config.calibrate = !string_compare(user_calibrate_cfg, "1");
+    user_config.calib_file = libmem_getenv("LIBMEM_CALIBRATE_FILE");
+}
 
-    token = (char *)strtok(user_threshold_cfg, ",");
-    if (token == NULL)
+void parse_env_adaptive_cfg(void)
+{
+    const char * user_adaptive_cfg;
+
+    user_adaptive_cfg = libmem_getenv("LIBMEM_ADAPTIVE");
+    if (user_adaptive_cfg == NULL)
     {
-        LOG_WARN("Failed to parse <repmov_start_threshold>.\n");
+        LOG_DEBUG("Environment variable LIBMEM_ADAPTIVE is not set.\n");
         return;
     }
-    user_config.user_threshold.repmov_start_threshold = strtoull(token, NULL, 10);
+    user_config.adaptive = !string_compare(user_adaptive_cfg, "1");
+}
 
-    token = (char *)strtok(NULL, ",");
-    if (token == NULL)
+void parse_env_variant_cfg(const char **variants)
+{
+    for (int func = 0; func < LIBMEM_FUNC_COUNT; func++)
     {
-        LOG_WARN("Failed to parse <repmov_stop_threshold>.\n");
+        variants[func] = libmem_getenv(variant_envs[func]);
+        if (variants[func] != NULL)
+            LOG_DEBUG("%s: %s\n", variant_envs[func], variants[func]);
+    }
+}
+
+void parse_env_experiment_cfg(void)
+{
+    static const char * const experiment_funcs[] =
+    {
+        [LIBMEM_MEMCPY] = "memcpy", [LIBMEM_MEMPCPY] = "mempcpy",
+        [LIBMEM_MEMMOVE] = "memmove", [LIBMEM_MEMSET] = "memset"
+    };
+    const char *user_experiment_cfg, *variant, *percent;
+    uint32_t func, len;
+    char *end;
+
+    user_experiment_cfg = libmem_getenv("LIBMEM_EXPERIMENT");
+    if (user_experiment_cfg == NULL)
+    {
+        LOG_DEBUG("Environment variable LIBMEM_EXPERIMENT is not set.\n");
         return;
     }
-    user_config.user_threshold.repmov_stop_threshold = strtoull(token,NULL,10);
+    LOG_DEBUG("LIBMEM_EXPERIMENT: %s\n", user_experiment_cfg);
 
-    token = (char *)strtok(NULL, ",");
-    if (token == NULL)
+    for (func = 0; func <= LIBMEM_MEMSET; func++)
+    {
+        if (!token_compare(user_experiment_cfg, ':', experiment_funcs[func]))
+            break;
+    }
+    variant = strchr(user_experiment_cfg, ':');
+    if (func > LIBMEM_MEMSET || variant == NULL)
     {
-        LOG_WARN("Failed to parse <nt_start_threshold>.\n");
+        LOG_WARN("invalid experiment function: %s\n", user_experiment_cfg);
         return;
     }
-    user_config.user_threshold.nt_start_threshold = strtoull(token,NULL,0);
-    token = (char *)strtok(NULL, ":");
-    if (token == NULL)
+    variant++;
+
+    // the candidate is copied out, the value points into the environment
+    for (len = 0; variant[len] && variant[len] != ':'; len++);
+    if (len == 0 || len >= EXPERIMENT_VARIANT_SZ)
     {
-        LOG_WARN("Failed to parse <nt_stop_threshold>.\n");
+        LOG_WARN("invalid experiment variant: %s\n", variant);
         return;
     }
-    user_config.user_threshold.nt_stop_threshold = strtoull(token,NULL,0);
 
-    active_threshold_cfg = USR_CFG;
+    user_config.experiment_percent = EXPERIMENT_DEFAULT_PERCENT;
+    if (variant[len] == ':')
+    {
+        percent = variant + len + 1;
+        user_config.experiment_percent = strtoul(percent, &end, 10);
+        if (end == percent || *end != '\0' || user_config.experiment_percent == 0
+            || user_config.experiment_percent > 100)
+        {
+            LOG_WARN("invalid experiment share: %s\n", percent);
+            return;
+        }
+    }
+
+    for (uint32_t idx = 0; idx < len; idx++)
+        user_config.experiment_variant[idx] = variant[idx];
+    user_config.experiment_variant[len] = '\0';
+    user_config.experiment_func = func;
+}
+
+void parse_env_canary_cfg(void)
+{
+    const char *user_canary_cfg;
+    unsigned long rate;
+    char *end;
+
+    user_canary_cfg = libmem_getenv("LIBMEM_CANARY");
+    if (user_canary_cfg == NULL)
+    {
+        LOG_DEBUG("Environment variable LIBMEM_CANARY is not set.\n");
+        return;
+    }
+
+    rate = strtoul(user_canary_cfg, &end, 0);
+    if (end == user_canary_cfg || *end != '\0' || rate == 0 || rate > UINT32_MAX / 2)
+    {
+        LOG_WARN("invalid canary rate: %s\n", user_canary_cfg);
+        return;
+    }
+    user_config.canary_rate = rate;
+}
+
+void parse_env_stats_cfg(void)
+{
+    const char *user_stats_cfg;
+
+    user_stats_cfg = libmem_getenv("LIBMEM_STATS");
+    if (user_stats_cfg == NULL)
+    {
+        LOG_DEBUG("Environment variable LIBMEM_STATS is not set.\n");
+        return;
+    }
+
+    if (!strcmp(user_stats_cfg, "1"))
+        user_config.stats = STATS_EXIT;
+    else if (!strcmp(user_stats_cfg, "shm"))
+        user_config.stats = STATS_SHM;
+    else if (strcmp(user_stats_cfg, "0"))
+        LOG_WARN("invalid stats mode: %s\n", user_stats_cfg);
 }
@@ -0,0 +1,309 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <x86intrin.h>
+#include <sys/mman.h>
+
+/*
+ * A/B experiment (LIBMEM_EXPERIMENT=<func>:<variant>[:<percent>]): every
+ * bucket of the function is bound to an experiment entry sending the given
+ * share of the calls, picked at random per call, to the candidate variant
+ * and the others to the entry dispatched before. Each call is timed with
+ * rdtsc into the counters of its thread: calls, cycles and squared cycles
+ * per arm and size bucket. The counters of all the threads are summed into
+ * a report of the mean cycles of both arms with 95% confidence intervals,
+ * at exit or on libmem_experiment_report().
+ * Rebinding the function (libmem_set_variant(), libmem_reload()) ends the
+ * experiment, the counters collected so far are still reported.
+ */
+
+#define EXPERIMENT_BASELINE     0
+#define EXPERIMENT_CANDIDATE    1
+#define EXPERIMENT_ARMS         2
+#define EXPERIMENT_Z95          1.96    //normal quantile of the 95% intervals
+#define EXPERIMENT_LINE_SZ      256
+
+typedef struct experiment_counters {
+    struct experiment_counters *next;
+    uint64_t calls[EXPERIMENT_ARMS][SC_BUCKET_COUNT];
+    uint64_t cycles[EXPERIMENT_ARMS][SC_BUCKET_COUNT];
+    double cycles_sq[EXPERIMENT_ARMS][SC_BUCKET_COUNT];
+} experiment_counters;
+
+static func_index experiment_func = FUNC_COUNT;     //FUNC_COUNT when no experiment runs
+static uint32_t experiment_percent;
+static const char *experiment_func_name;
+static const char *experiment_names[EXPERIMENT_ARMS];
+static func_ptr experiment_impls[EXPERIMENT_ARMS][SC_BUCKET_COUNT];
+
+// counters of every thread that ran the experiment, never freed
+static experiment_counters *experiment_threads;
+
+static __thread experiment_counters *experiment_tls __attribute__((tls_model("initial-exec")));
+static __thread uint32_t experiment_seed __attribute__((tls_model("initial-exec")));
+
+/* Maps the counters of the thread, on its first experiment call
+ * returns: counters, NULL on failure
+ */
+static __attribute__((noinline)) experiment_counters *experiment_thread_counters(void)
+{
+    experiment_counters *cnt;
+
+    cnt = mmap(NULL, sizeof(experiment_counters), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (cnt == MAP_FAILED)
+        return NULL;
+
+    cnt->next = __atomic_load_n(&experiment_threads, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&experiment_threads, &cnt->next, cnt, true,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+    experiment_tls = cnt;
+    return cnt;
+}
+
+/* Picks the arm of the call
+ * returns: EXPERIMENT_CANDIDATE on the configured share of the calls
+ */
+static inline unsigned int experiment_arm(void)
+{
+    uint32_t rnd = experiment_seed;
+
+    if (rnd == 0)
+        rnd = (uint32_t)__rdtsc() | 1;
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    experiment_seed = rnd;
+
+    return (((uint64_t)rnd * 100) >> 32) < experiment_percent;
+}
+
+static inline void experiment_record(unsigned int arm, size_t bkt, uint64_t cycles)
+{
+    experiment_counters *cnt = experiment_tls;
+
+    if (unlikely(cnt == NULL) && (cnt = experiment_thread_counters()) == NULL)
+        return;
+    cnt->calls[arm][bkt]++;
+    cnt->cycles[arm][bkt] += cycles;
+    cnt->cycles_sq[arm][bkt] += (double)cycles * cycles;
+}
+
+// Experiment entries of the size class dispatched functions
+static void *__memcpy_experiment(void *dst, const void *src, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+    unsigned int arm = experiment_arm();
+    uint64_t start = __rdtsc();
+
+    ((amd_memcpy_fn) experiment_impls[arm][bkt])(dst, src, size);
+    experiment_record(arm, bkt, __rdtsc() - start);
+    return dst;
+}
+
+static void *__mempcpy_experiment(void *dst, const void *src, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+    unsigned int arm = experiment_arm();
+    uint64_t start = __rdtsc();
+    void *ret;
+
+    ret = ((amd_mempcpy_fn) experiment_impls[arm][bkt])(dst, src, size);
+    experiment_record(arm, bkt, __rdtsc() - start);
+    return ret;
+}
+
+static void *__memmove_experiment(void *dst, const void *src, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+    unsigned int arm = experiment_arm();
+    uint64_t start = __rdtsc();
+
+    ((amd_memmove_fn) experiment_impls[arm][bkt])(dst, src, size);
+    experiment_record(arm, bkt, __rdtsc() - start);
+    return dst;
+}
+
+static void *__memset_experiment(void *mem, int val, size_t size)
+{
+    size_t bkt = 63 - __builtin_clzl(size | 1);
+    unsigned int arm = experiment_arm();
+    uint64_t start = __rdtsc();
+
+    ((amd_memset_fn) experiment_impls[arm][bkt])(mem, val, size);
+    experiment_record(arm, bkt, __rdtsc() - start);
+    return mem;
+}
+
+static const func_ptr experiment_entries[SC_FUNC_COUNT] =
+{
+    [MEMCPY]    = (func_ptr) __memcpy_experiment,
+    [MEMPCPY]   = (func_ptr) __mempcpy_experiment,
+    [MEMMOVE]   = (func_ptr) __memmove_experiment,
+    [MEMSET]    = (func_ptr) __memset_experiment,
+};
+
+/* Entry the baseline arm of the bucket runs, seen through the experiment entry
+ * returns: function pointer
+ */
+static inline func_ptr experiment_unwrap(func_index idx, func_ptr impl)
+{
+    if (idx == experiment_func && impl == experiment_entries[idx])
+        return experiment_impls[EXPERIMENT_BASELINE][SC_BUCKET_COUNT - 1];
+    return impl;
+}
+
+/* Square root of a non-negative double, without libm
+ * returns: square root
+ */
+static inline double experiment_sqrt(double val)
+{
+    return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(val)));
+}
+
+/* Sums the counters of the bucket over all the threads
+ * returns: void
+ */
+static inline void experiment_sum(size_t bkt, uint64_t calls[EXPERIMENT_ARMS],
+                                  double mean[EXPERIMENT_ARMS], double var[EXPERIMENT_ARMS])
+{
+    experiment_counters *cnt;
+
+    for (unsigned int arm = 0; arm < EXPERIMENT_ARMS; arm++)
+    {
+        double sum = 0, sum_sq = 0;
+
+        calls[arm] = 0;
+        // counters of running threads are read as they are being updated
+        for (cnt = __atomic_load_n(&experiment_threads, __ATOMIC_ACQUIRE); cnt; cnt = cnt->next)
+        {
+            calls[arm] += cnt->calls[arm][bkt];
+            sum += cnt->cycles[arm][bkt];
+            sum_sq += cnt->cycles_sq[arm][bkt];
+        }
+        mean[arm] = calls[arm] ? sum / calls[arm] : 0;
+        var[arm] = (calls[arm] > 1) ? (sum_sq - sum * mean[arm]) / (calls[arm] - 1) : 0;
+        if (var[arm] < 0)
+            var[arm] = 0;
+    }
+}
+
+/* Writes the mean cycles of both arms per size bucket with their 95%
+ * confidence intervals, and the change of the candidate over the baseline
+ * returns: 0 on success, -1 without experiment or on write failure
+ */
+static inline int experiment_report(int fd)
+{
+    char line[EXPERIMENT_LINE_SZ];
+    int len;
+
+    if (experiment_func == FUNC_COUNT)
+        return -1;
+
+    len = snprintf(line, EXPERIMENT_LINE_SZ,
+                   "libmem experiment %s: baseline %s, candidate %s on %u%% of the calls\n"
+                   "%-22s %12s %22s %12s %22s %18s\n", experiment_func_name,
+                   experiment_names[EXPERIMENT_BASELINE], experiment_names[EXPERIMENT_CANDIDATE],
+                   experiment_percent, "size", "base calls", "base cycles (95% CI)",
+                   "cand calls", "cand cycles (95% CI)", "change (95% CI)");
+    if (write(fd, line, len) != len)
+        return -1;
+
+    for (size_t bkt = 0; bkt < SC_BUCKET_COUNT; bkt++)
+    {
+        uint64_t calls[EXPERIMENT_ARMS];
+        double mean[EXPERIMENT_ARMS], var[EXPERIMENT_ARMS], ci[EXPERIMENT_ARMS];
+        char size[32];
+
+        experiment_sum(bkt, calls, mean, var);
+        if (calls[EXPERIMENT_BASELINE] == 0 && calls[EXPERIMENT_CANDIDATE] == 0)
+            continue;
+
+        for (unsigned int arm = 0; arm < EXPERIMENT_ARMS; arm++)
+            ci[arm] = calls[arm] ? EXPERIMENT_Z95 * experiment_sqrt(var[arm] / calls[arm]) : 0;
+
+        snprintf(size, sizeof(size), "%lu-%lu", bkt ? 1UL << bkt : 0, (2UL << bkt) - 1);
+        len = snprintf(line, EXPERIMENT_LINE_SZ, "%-22s %12lu %12.1f +- %-7.1f %12lu %12.1f +- %-7.1f",
+                       size, calls[EXPERIMENT_BASELINE], mean[EXPERIMENT_BASELINE],
+                       ci[EXPERIMENT_BASELINE], calls[EXPERIMENT_CANDIDATE],
+                       mean[EXPERIMENT_CANDIDATE], ci[EXPERIMENT_CANDIDATE]);
+        // difference of the means relative to the baseline, Welch interval
+        if (calls[EXPERIMENT_BASELINE] > 1 && calls[EXPERIMENT_CANDIDATE] > 1
+            && mean[EXPERIMENT_BASELINE] > 0)
+            len += snprintf(line + len, EXPERIMENT_LINE_SZ - len, " %+7.1f%% +- %.1f%%\n",
+                            100 * (mean[EXPERIMENT_CANDIDATE] - mean[EXPERIMENT_BASELINE])
+                                / mean[EXPERIMENT_BASELINE],
+                            100 * experiment_sqrt(ci[EXPERIMENT_BASELINE] * ci[EXPERIMENT_BASELINE]
+                                + ci[EXPERIMENT_CANDIDATE] * ci[EXPERIMENT_CANDIDATE])
+                                / mean[EXPERIMENT_BASELINE]);
+        else
+            len += snprintf(line + len, EXPERIMENT_LINE_SZ - len, " %18s\n", "-");
+
+        if (write(fd, line, len) != len)
+            return -1;
+    }
+    return 0;
+}
+
+/* Binds the buckets of the function to the experiment entries, the candidate
+ * arm running the named variant and the baseline arm the dispatched entries
+ * returns: void
+ */
+static inline void configure_experiment(func_index idx, const char *func_name,
+                                        const char *baseline, const char *candidate,
+                                        uint32_t percent)
+{
+    func_ptr impls[SIZE_CLASS_COUNT];
+
+    if (idx >= SC_FUNC_COUNT || libmem_variant_impls(idx, candidate, impls) != 0)
+    {
+        LOG_WARN("invalid or unsupported experiment variant: %s\n", candidate);
+        return;
+    }
+
+    experiment_func_name = func_name;
+    experiment_names[EXPERIMENT_BASELINE] = baseline;
+    experiment_names[EXPERIMENT_CANDIDATE] = candidate;
+    experiment_percent = percent;
+    for (size_t bkt = 0; bkt < SC_BUCKET_COUNT; bkt++)
+    {
+        experiment_impls[EXPERIMENT_BASELINE][bkt] = libmem_dispatch_slots[idx][bkt];
+        experiment_impls[EXPERIMENT_CANDIDATE][bkt] = impls[libmem_size_class(bkt)];
+    }
+    experiment_func = idx;
+
+    for (size_t bkt = 0; bkt < SC_BUCKET_COUNT; bkt++)
+        __atomic_store_n(&libmem_dispatch_slots[idx][bkt], experiment_entries[idx],
+                            __ATOMIC_RELEASE);
+    LOG_INFO("Experiment on %s: %s against %s on %u%% of the calls\n",
+             func_name, candidate, baseline, percent);
+}
+
+static __attribute__((destructor)) void experiment_fini(void)
+{
+    if (experiment_func != FUNC_COUNT)
+        experiment_report(STDERR_FILENO);
+}
@@ -130,7 +130,7 @@ static inline void *_memcpy_avx2(void * __restrict dst, const void * __restrict
     // Matching alignments of load & store addresses;
     if (unlikely((((size_t)src & (YMM_SZ - 1)) == ((size_t)dst & (YMM_SZ - 1)))))
     {
-        if (size < __nt_start_threshold)
+        if (size < __nt_start_threshold_cur())
         {
            __aligned_load_and_store_4ymm_vec_loop(dst, src, size - 4 * YMM_SZ, dst_align);
         }
@@ -142,7 +142,7 @@ static inline void *_memcpy_avx2(void * __restrict dst, const void * __restrict
     // Mismatching alignments of load & store addresses;
     else
     {
-        if (size < __nt_start_threshold)
+        if (size < __nt_start_threshold_cur())
         {
            __unaligned_load_aligned_store_4ymm_vec_loop_pftch(dst, src, size - 4 * YMM_SZ, dst_align);
         }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -61,14 +61,14 @@ static inline void *_memmove_avx2(void *dst, const void *src, size_t size)
         //Aligned Load and Store addresses
         if (((uintptr_t)src & (YMM_SZ - 1)) == dst_align)
         {
-            if (size < __nt_start_threshold)
+            if (size < __memmove_nt_start_threshold_cur())
                __aligned_load_and_store_4ymm_vec_loop(dst, src, size - 4 * YMM_SZ, offset);
             else
                __aligned_load_nt_store_4ymm_vec_loop_pftch(dst, src, size - 4 * YMM_SZ, offset);
         }
         else
         {
-            if (size < __nt_start_threshold)
+            if (size < __memmove_nt_start_threshold_cur())
                __unaligned_load_and_store_4ymm_vec_loop(dst, src, size - 4 * YMM_SZ, offset);
             else
                __unaligned_load_nt_store_4ymm_vec_loop(dst, src, size - 4 * YMM_SZ, offset);
@@ -1,4 +1,4 @@
-/* Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2025-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -34,6 +34,13 @@
 
 extern cpu_info zen_info;
 
+// memmove reads the non-temporal threshold of its own block
+#if defined(MEMMOVE_AVX512) || defined(MEMMOVE_AVX512_ERMS)
+#define ALM_NT_START_THRESHOLD  __memmove_nt_start_threshold_cur
+#else
+#define ALM_NT_START_THRESHOLD  __nt_start_threshold_cur
+#endif
+
 #ifdef MEMMOVE_AVX512
 static inline void *_memcpy_avx512(void *dst, const void *src, size_t size)
 #else
@@ -148,7 +155,7 @@ static inline void *_memcpy_avx512(void *__restrict dst, const void *__restrict
                 offset = __aligned_load_and_store_4zmm_vec_loop(dst, src, size - 8 * ZMM_SZ, offset);
             }
             // 4-YMM registers with prefetch
-            else if (size < __nt_start_threshold)
+            else if (size < ALM_NT_START_THRESHOLD())
             {
                 offset = __aligned_load_and_store_4zmm_vec_loop_pftch(dst, src, size - 8 * ZMM_SZ, offset);
             }
@@ -161,7 +168,7 @@ static inline void *_memcpy_avx512(void *__restrict dst, const void *__restrict
         // Unaligned Load/Store addresses: force-align store address to ZMM size
         else
         {
-            if (size < __nt_start_threshold)
+            if (size < ALM_NT_START_THRESHOLD())
             {
                 offset = __unaligned_load_aligned_store_4zmm_vec_loop(dst, src, size - 8 * ZMM_SZ, offset);
             } else
@@ -379,7 +386,7 @@ static inline void *_memcpy_avx512_erms(void *__restrict dst, const void *__rest
         return ret;
     }
     // rep-movs up to NT start threshold
-    else if (size < __nt_start_threshold)
+    else if (size < ALM_NT_START_THRESHOLD())
     {
         __erms_movsb(dst, src, size);
         return ret;
@@ -98,7 +98,7 @@ static inline void *_memset_avx512_erms(void *mem, int val, size_t size)
             } while (offset < (size - 4 * ZMM_SZ));
         }
         // rep-stores for sizes upto L3 cache per CCX
-        else if (size <= __repstore_stop_threshold)
+        else if (size <= __repstore_stop_threshold_cur())
         {
                 __erms_stosb(mem + offset, val, size - offset);
                 return ret;
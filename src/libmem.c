@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -31,9 +31,12 @@ HIDDEN_SYMBOL config active_threshold_cfg = SYS_CFG;
 extern user_cfg user_config;
 
 #include "cache_info.c"
+#include "cache_budget.c"
 #include "threshold.c"
+#include "core_class.c"
 
 #ifdef ALMEM_DYN_DISPATCH
+#include "system_impls.h"
 #ifdef ALMEM_TUNABLES
 #include "libmem_dispatcher.c"
 #else //ifunc-dispatching
@@ -41,28 +44,92 @@ extern user_cfg user_config;
 #endif
 #endif //eof DYN_DISPATCH
 
+#ifdef ALMEM_TUNABLES
+#include "calibration.c"
+#include "adaptive.c"
+#include "experiment.c"
+#include "canary.c"
+#include "stats.c"
+#endif
+#include "libmem_runtime.c"
+
 /* Constructor for libmem library
  * returns: void
  */
 static __attribute__((constructor)) void libmem_init()
 {
     LOG_INFO("aocl-libmem Version: %s\n", LIBMEM_BUILD_VERSION);
-    bool is_amd_cpu = is_amd();
-    if (is_amd_cpu == true)
-    {
+#ifdef ALMEM_DYN_DISPATCH
+    __system_impls_init();
+#endif
+    zen_info.vendor = get_cpu_vendor();
+    if (is_amd_vendor(zen_info.vendor))
         LOG_INFO("Is AMD CPU\n");
-        get_cpu_capabilities();
+    else
+        LOG_INFO("Is non-AMD CPU, dispatching on CPU features\n");
+    get_cpu_capabilities();
+    zen_info.zen_uarch = get_cpu_uarch();
+    if (get_arch_override() != UARCH_UNKNOWN)
+        LOG_INFO("LIBMEM_ARCH override: Zen%u\n", get_arch_override());
 #ifdef ALMEM_TUNABLES
-        parse_env_operation_cfg();
-        if (active_operation_cfg == SYS_CFG)
-            parse_env_threshold_cfg();
+    user_config.direct_bind = libmem_direct_bind_cfg();
+    parse_env_config_cfg();
+    parse_env_operation_cfg();
+    if (active_operation_cfg == SYS_CFG)
+        parse_env_threshold_cfg();
+    parse_env_l3_sharing_cfg();
+    parse_env_sysfs_root_cfg();
+    parse_env_calibrate_cfg();
+    parse_env_adaptive_cfg();
+    parse_env_experiment_cfg();
+    parse_env_canary_cfg();
+    parse_env_stats_cfg();
+    // the loader bound the functions, their entries cannot be wrapped
+    if (user_config.direct_bind && (user_config.adaptive || user_config.canary_rate != 0
+                                    || user_config.experiment_variant[0] != '\0'
+                                    || user_config.stats != STATS_OFF))
+    {
+        LOG_WARN("LIBMEM_ADAPTIVE, LIBMEM_EXPERIMENT, LIBMEM_CANARY and LIBMEM_STATS need "
+                 "LIBMEM_DIRECT_BIND unset\n");
+        user_config.adaptive = false;
+        user_config.canary_rate = 0;
+        user_config.experiment_variant[0] = '\0';
+        user_config.stats = STATS_OFF;
+    }
 #endif
-        if (active_operation_cfg == SYS_CFG && active_threshold_cfg == SYS_CFG)
-            compute_sys_thresholds(&zen_info);
+    // user thresholds replace the system ones of the blocks they set,
+    // reloads without user thresholds fall back to them
+    compute_sys_thresholds(&zen_info);
 
-        configure_thresholds();
+    if (active_operation_cfg == SYS_CFG && active_threshold_cfg == SYS_CFG)
+    {
+#ifdef ALMEM_TUNABLES
+        // measured thresholds replace the formulas of every core class
+        if (user_config.calibrate)
+            calibrate_thresholds(&zen_info);
+        else
+#endif
+        configure_core_classes(&zen_info);
+        __sys_core_class_count = __core_class_count;
     }
+    // GLIBC_TUNABLES thresholds of a drop-in replacement of glibc
+    configure_glibc_thresholds(&zen_info);
+
+    configure_thresholds();
 #ifdef ALMEM_TUNABLES
     dispatcher_init();
+    if (user_config.adaptive && active_operation_cfg == SYS_CFG && active_threshold_cfg == SYS_CFG)
+        configure_adaptive(&zen_info);
+    if (user_config.experiment_variant[0] != '\0')
+        configure_experiment((func_index) user_config.experiment_func,
+                             libmem_func_names[user_config.experiment_func],
+                             libmem_variant_name((func_index) user_config.experiment_func),
+                             user_config.experiment_variant, user_config.experiment_percent);
+    // checks the entries of the experiment too
+    if (user_config.canary_rate != 0)
+        configure_canary(user_config.canary_rate, libmem_func_names);
+    // counts the calls of the canary and experiment entries alike
+    if (user_config.stats != STATS_OFF)
+        configure_stats(user_config.stats, libmem_func_names);
 #endif
 }
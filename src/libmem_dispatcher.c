@@ -1,4 +1,4 @@
-/* Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2025-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,6 +23,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string.h>
 #include "libmem_impls.h"
 #include "almem_defs.h"
 #include "libmem.h"
@@ -30,55 +31,72 @@
 
 extern cpu_info zen_info;
 
+// CPU variant picked by dispatcher_init()
+static cpu_variant_idx libmem_cpu_var_idx = SYSTEM;
+
 /* Resolver to identify the zen cpu version
  * returns: cpu variant index
  */
 static inline cpu_variant_idx libmem_cpu_resolver(void)
 {
-    cpu_variant_idx cpu_var_idx = SYSTEM;
-    // Zen4 and above cpu detection
-    if (zen_info.zen_cpu_features.avx512 == ENABLED)
+    if (zen_info.zen_uarch == UARCH_UNKNOWN)
     {
-        if (zen_info.zen_cpu_features.movdiri == ENABLED)// Zen5
-        {
-            cpu_var_idx = ARCH_ZEN5;
-            LOG_INFO("Detected CPU uArch: Zen5\n");
-        }
-        else
-        {
-            cpu_var_idx = ARCH_ZEN4;
-            LOG_INFO("Detected CPU uArch: Zen4\n");
-        }
+        //System operation Config
+        LOG_INFO("System Operation CFG\n");
+        return SYSTEM;
     }
-    // Zen3 and below cpu detection
-    else if (zen_info.zen_cpu_features.avx2 == ENABLED)
+    LOG_INFO("Detected CPU uArch: Zen%u\n", zen_info.zen_uarch);
+    return (cpu_variant_idx)(ARCH_ZEN1 + (zen_info.zen_uarch - ZEN1));
+}
+
+#ifdef ALMEM_TUNABLES
+/* Tunable variant of the user operation and alignments. Free of libc and of
+ * the user config: called from the IFUNC resolvers.
+ * returns: tunable variant index
+ */
+static inline tunable_variant_idx libmem_operation_variant(cpu_operation op,
+                                                           alignment src_aln, alignment dst_aln)
+{
+    if (op.avx2) //AVX2 operations
     {
-        if (zen_info.zen_cpu_features.vpclmul == ENABLED) // Zen3
-        {
-            cpu_var_idx = ARCH_ZEN3;
-            LOG_INFO("Detected CPU uArch: Zen3\n");
-        }
-        else if (zen_info.zen_cpu_features.rdpid == ENABLED) // Zen2
-        {
-            cpu_var_idx = ARCH_ZEN2;
-            LOG_INFO("Detected CPU uArch: Zen2\n");
-        }
-        else if (zen_info.zen_cpu_features.rdseed == ENABLED) // Zen1
-        {
-            cpu_var_idx = ARCH_ZEN1;
-            LOG_INFO("Detected CPU uArch: Zen1\n");
-        }
-        else
+        if (src_aln == n_align)
+            return (dst_aln == n_align) ? AVX2_NON_TEMPORAL : AVX2_NON_TEMPORAL_LOAD;
+        if (dst_aln == n_align)
+            return AVX2_NON_TEMPORAL_STORE;
+        if (src_aln == y_align)
+            return (dst_aln == y_align) ? AVX2_ALIGNED : AVX2_ALIGNED_LOAD;
+        if (dst_aln == y_align)
+            return AVX2_ALIGNED_STORE;
+        return AVX2_UNALIGNED;
+    }
+    if (op.avx512) //AVX512 operations
+    {
+        if (src_aln == n_align)
+            return (dst_aln == n_align) ? AVX512_NON_TEMPORAL : AVX512_NON_TEMPORAL_LOAD;
+        if (dst_aln == n_align)
+            return AVX512_NON_TEMPORAL_STORE;
+        if (src_aln == y_align)
+            return (dst_aln == y_align) ? AVX512_ALIGNED : AVX512_ALIGNED_LOAD;
+        if (dst_aln == y_align)
+            return AVX512_ALIGNED_STORE;
+        return AVX512_UNALIGNED;
+    }
+    if (op.erms) //ERMS operations
+    {
+        if (src_aln == dst_aln)
         {
-            //System operation Config
-            LOG_INFO("System Operation CFG\n");
-            cpu_var_idx = SYSTEM;
+            if (src_aln == q_align || src_aln == x_align || src_aln == y_align)
+                return ERMS_MOVSQ;
+            if (src_aln == d_align)
+                return ERMS_MOVSD;
+            if (src_aln == w_align)
+                return ERMS_MOVSW;
         }
+        return ERMS_MOVSB;
     }
-    return cpu_var_idx;
+    return UNKNOWN;
 }
 
-#ifdef ALMEM_TUNABLES
 /* Resolver to identify the tunable config
  * returns: tunable varaint index
  */
@@ -89,70 +107,10 @@ static inline tunable_variant_idx libmem_tunable_resolver(void)
     if (active_operation_cfg == USR_CFG) //User Operation Config
     {
         LOG_INFO("User Operation Config\n");
-        if (user_config.user_operation.avx2) //AVX2 operations
-        {
-            LOG_DEBUG("AVX2 config\n");
-            if (user_config.src_aln == n_align)
-            {
-                if (user_config.dst_aln == n_align)
-                    tun_var_idx = AVX2_NON_TEMPORAL;
-                else
-                    tun_var_idx = AVX2_NON_TEMPORAL_LOAD;
-            }
-            else if (user_config.dst_aln == n_align)
-                tun_var_idx = AVX2_NON_TEMPORAL_STORE;
-            else if (user_config.src_aln == y_align)
-            {
-                if (user_config.dst_aln == y_align)
-                    tun_var_idx = AVX2_ALIGNED;
-                else
-                    tun_var_idx = AVX2_ALIGNED_LOAD;
-            }
-            else if (user_config.dst_aln == y_align)
-                tun_var_idx = AVX2_ALIGNED_STORE;
-            else
-                tun_var_idx = AVX2_UNALIGNED;
-        }
-        else if (user_config.user_operation.avx512) //AVX512 operations
-        {
-            LOG_DEBUG("AVX512 config\n");
-            if (user_config.src_aln == n_align)
-            {
-                if (user_config.dst_aln == n_align)
-                    tun_var_idx = AVX512_NON_TEMPORAL;
-                else
-                    tun_var_idx = AVX512_NON_TEMPORAL_LOAD;
-            }
-            else if (user_config.dst_aln == n_align)
-                tun_var_idx = AVX512_NON_TEMPORAL_STORE;
-            else if (user_config.src_aln == y_align)
-            {
-                if (user_config.dst_aln == y_align)
-                    tun_var_idx = AVX512_ALIGNED;
-                else
-                    tun_var_idx = AVX512_ALIGNED_LOAD;
-            }
-            else if (user_config.dst_aln == y_align)
-                tun_var_idx = AVX512_ALIGNED_STORE;
-            else
-                tun_var_idx = AVX512_UNALIGNED;
-        }
-        else if (user_config.user_operation.erms) //ERMS operations
-        {
-            LOG_DEBUG("ERMS config\n");
-            tun_var_idx = ERMS_MOVSB;
-            if (user_config.src_aln == user_config.dst_aln)
-            {
-                if (user_config.src_aln == q_align \
-                    || user_config.src_aln == x_align \
-                    || user_config.src_aln == y_align)
-                    tun_var_idx = ERMS_MOVSQ;
-                else if (user_config.src_aln == d_align)
-                    tun_var_idx = ERMS_MOVSD;
-                else if (user_config.src_aln == w_align)
-                    tun_var_idx = ERMS_MOVSW;
-            }
-        }
+        tun_var_idx = libmem_operation_variant(user_config.user_operation,
+                                               user_config.src_aln, user_config.dst_aln);
+        if (tun_var_idx != UNKNOWN)
+            LOG_DEBUG("%s config\n", libmem_tun_variant_names[tun_var_idx]);
     }
     else if (active_threshold_cfg == USR_CFG) // User Threshold Config
     {
@@ -163,28 +121,74 @@ static inline tunable_variant_idx libmem_tunable_resolver(void)
 }
 #endif // end of tunable resolver
 
-static inline void dispatcher_init()
+/* Maps a log2(size) bucket of the dispatching tables to its size class
+ * returns: size class index
+ */
+static inline size_class_idx libmem_size_class(size_t bkt)
+{
+    if (bkt < SC_SMALL_SZ_LOG2)
+        return SC_SMALL;
+    if (bkt < SC_MEDIUM_SZ_LOG2)
+        return SC_MEDIUM;
+    return SC_LARGE;
+}
+
+// Dispatching slots of the functions, rebound at runtime by libmem_set_variant()
+// and libmem_reload()
+static func_ptr * const libmem_dispatch_slots[FUNC_COUNT] =
+{
+    [MEMCPY]    = (func_ptr *) _memcpy_sc_variants,
+    [MEMPCPY]   = (func_ptr *) _mempcpy_sc_variants,
+    [MEMMOVE]   = (func_ptr *) _memmove_sc_variants,
+    [MEMSET]    = (func_ptr *) _memset_sc_variants,
+    [MEMCMP]    = (func_ptr *) &_memcmp_variant,
+    [MEMCHR]    = (func_ptr *) &_memchr_variant,
+    [STRCPY]    = (func_ptr *) &_strcpy_variant,
+    [STRNCPY]   = (func_ptr *) &_strncpy_variant,
+    [STRCMP]    = (func_ptr *) &_strcmp_variant,
+    [STRNCMP]   = (func_ptr *) &_strncmp_variant,
+    [STRCAT]    = (func_ptr *) &_strcat_variant,
+    [STRNCAT]   = (func_ptr *) &_strncat_variant,
+    [STRSTR]    = (func_ptr *) &_strstr_variant,
+    [STRLEN]    = (func_ptr *) &_strlen_variant,
+    [STRNLEN]   = (func_ptr *) &_strnlen_variant,
+    [STRCHR]    = (func_ptr *) &_strchr_variant,
+    [STRSPN]    = (func_ptr *) &_strspn_variant,
+};
+
+/* Rebinds the function to the size class entries of a variant. Every slot is
+ * published with a single atomic store, so a concurrent call jumps to either
+ * the previous or the new entry of its size class, never to a torn pointer.
+ */
+static inline void libmem_dispatch_publish(func_index idx,
+                                           const func_ptr impls[SIZE_CLASS_COUNT])
+{
+    if (idx < SC_FUNC_COUNT)
+    {
+        for (size_t bkt = 0; bkt < SC_BUCKET_COUNT; bkt++)
+            __atomic_store_n(&libmem_dispatch_slots[idx][bkt],
+                                impls[libmem_size_class(bkt)], __ATOMIC_RELEASE);
+        return;
+    }
+    __atomic_store_n(libmem_dispatch_slots[idx], impls[SC_LARGE], __ATOMIC_RELEASE);
+}
+
+/* Resolves the size class entries of every function: the cpu variant,
+ * replaced by the tunable variant of the user operation or threshold config
+ * returns: void
+ */
+static inline void libmem_dispatch_resolve(func_ptr impls[FUNC_COUNT][SIZE_CLASS_COUNT])
 {
     cpu_variant_idx cpu_var_idx = SYSTEM;
     cpu_var_idx  = libmem_cpu_resolver();
+    libmem_cpu_var_idx = cpu_var_idx;
 
-    _memcpy_variant     = (amd_memcpy_fn) libmem_cpu_impls[MEMCPY][cpu_var_idx];
-    _mempcpy_variant    = (amd_mempcpy_fn) libmem_cpu_impls[MEMPCPY][cpu_var_idx];
-    _memmove_variant    = (amd_memmove_fn) libmem_cpu_impls[MEMMOVE][cpu_var_idx];
-    _memset_variant     = (amd_memset_fn) libmem_cpu_impls[MEMSET][cpu_var_idx];
-    _memcmp_variant     = (amd_memcmp_fn) libmem_cpu_impls[MEMCMP][cpu_var_idx];
-    _memchr_variant     = (amd_memchr_fn) libmem_cpu_impls[MEMCHR][cpu_var_idx];
-    _strcpy_variant     = (amd_strcpy_fn) libmem_cpu_impls[STRCPY][cpu_var_idx];
-    _strncpy_variant    = (amd_strncpy_fn) libmem_cpu_impls[STRNCPY][cpu_var_idx];
-    _strcmp_variant     = (amd_strcmp_fn) libmem_cpu_impls[STRCMP][cpu_var_idx];
-    _strncmp_variant    = (amd_strncmp_fn) libmem_cpu_impls[STRNCMP][cpu_var_idx];
-    _strcat_variant     = (amd_strcat_fn) libmem_cpu_impls[STRCAT][cpu_var_idx];
-    _strncat_variant    = (amd_strncat_fn) libmem_cpu_impls[STRNCAT][cpu_var_idx];
-    _strstr_variant     = (amd_strstr_fn) libmem_cpu_impls[STRSTR][cpu_var_idx];
-    _strlen_variant     = (amd_strlen_fn) libmem_cpu_impls[STRLEN][cpu_var_idx];
-    _strnlen_variant    = (amd_strnlen_fn) libmem_cpu_impls[STRNLEN][cpu_var_idx];
-    _strchr_variant     = (amd_strchr_fn) libmem_cpu_impls[STRCHR][cpu_var_idx];
-    _strspn_variant     = (amd_strspn_fn) libmem_cpu_impls[STRSPN][cpu_var_idx];
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+    {
+        for (size_class_idx sc = SC_SMALL; sc < SIZE_CLASS_COUNT; sc++)
+            impls[idx][sc] = (idx < SC_FUNC_COUNT) ? libmem_sc_impls[idx][cpu_var_idx][sc]
+                                                   : libmem_cpu_impls[idx][cpu_var_idx];
+    }
 
 #ifdef ALMEM_TUNABLES
     tunable_variant_idx tun_var_idx = libmem_tunable_resolver();
@@ -192,11 +196,268 @@ static inline void dispatcher_init()
     //pick the tunable implementation only with valid tunable config
     if (tun_var_idx != UNKNOWN)
     {
-        _memcpy_variant     = (amd_memcpy_fn) libmem_cpu_impls[MEMCPY][cpu_var_idx];
-        _mempcpy_variant    = (amd_mempcpy_fn) libmem_cpu_impls[MEMPCPY][cpu_var_idx];
-        _memmove_variant    = (amd_memmove_fn) libmem_cpu_impls[MEMMOVE][cpu_var_idx];
-        _memset_variant     = (amd_memset_fn) libmem_cpu_impls[MEMSET][cpu_var_idx];
-        _memcmp_variant     = (amd_memcmp_fn) libmem_cpu_impls[MEMCMP][cpu_var_idx];
+        //tunable variants serve all the size classes, string functions without
+        //an implementation of the variant keep the cpu variant
+        for (func_index idx = MEMCPY; idx < TUN_FUNC_COUNT; idx++)
+        {
+            if (libmem_tun_impls[idx][tun_var_idx] == NULL)
+                continue;
+            for (size_class_idx sc = SC_SMALL; sc < SIZE_CLASS_COUNT; sc++)
+                impls[idx][sc] = libmem_tun_impls[idx][tun_var_idx];
+        }
     }
 #endif //end of tunables
 }
+
+#ifdef ALMEM_TUNABLES
+/* Checks the ISA the cpu variant is built for is available
+ * returns: true if supported
+ */
+static inline bool libmem_cpu_variant_supported(cpu_variant_idx var, bool avx2, bool avx512)
+{
+    switch (var)
+    {
+        case SYSTEM:
+            return true;
+        case ARCH_ZEN4:
+        case ARCH_ZEN5:
+            return avx512;
+        default:
+            return avx2;
+    }
+}
+
+/* Checks the ISA the tunable variant is built for is available
+ * returns: true if supported
+ */
+static inline bool libmem_tun_variant_supported(tunable_variant_idx var, bool avx2, bool avx512)
+{
+    if (var <= AVX2_NON_TEMPORAL_STORE)
+        return avx2;
+    if (var <= AVX512_NON_TEMPORAL_STORE)
+        return avx512;
+    // threshold variant falls back to avx2 without avx512
+    if (var == THRESHOLD)
+        return avx2;
+    return true;
+}
+
+/* Compares a variant name with the name of a variant, without libc
+ * returns: true if equal
+ */
+static inline bool libmem_variant_name_equal(const char *variant, const char *name)
+{
+    while (*variant && *variant == *name)
+    {
+        variant++;
+        name++;
+    }
+    return *variant == *name;
+}
+
+/* Looks up the named variant of the function on a CPU with the given ISA: the
+ * cpu variant, CPU_VARIANT_COUNT for a tunable variant. Free of libc: called
+ * from the IFUNC resolvers.
+ * returns: 0 on success, -1 on unknown or unsupported variant
+ */
+static inline int libmem_variant_find(func_index idx, const char *variant, bool avx2,
+                                      bool avx512, cpu_variant_idx *cpu_var,
+                                      tunable_variant_idx *tun_var)
+{
+    for (cpu_variant_idx var = ARCH_ZEN1; var < CPU_VARIANT_COUNT; var++)
+    {
+        if (!libmem_variant_name_equal(variant, libmem_cpu_variant_names[var]))
+            continue;
+        if (!libmem_cpu_variant_supported(var, avx2, avx512))
+            return -1;
+        *cpu_var = var;
+        return 0;
+    }
+    for (tunable_variant_idx var = AVX2_UNALIGNED; var < TUN_VARIANT_COUNT; var++)
+    {
+        if (!libmem_variant_name_equal(variant, libmem_tun_variant_names[var]))
+            continue;
+        if (!libmem_tun_variant_supported(var, avx2, avx512) || libmem_tun_impls[idx][var] == NULL)
+            return -1;
+        *cpu_var = CPU_VARIANT_COUNT;
+        *tun_var = var;
+        return 0;
+    }
+    return -1;
+}
+
+/* Looks up the size class entries of the named variant of the function
+ * returns: 0 on success, -1 on unknown or unsupported variant
+ */
+static inline int libmem_variant_impls(func_index idx, const char *variant,
+                                       func_ptr impls[SIZE_CLASS_COUNT])
+{
+    cpu_variant_idx cpu_var = SYSTEM;
+    tunable_variant_idx tun_var = UNKNOWN;
+
+    if (libmem_variant_find(idx, variant, zen_info.zen_cpu_features.avx2 == ENABLED,
+                            zen_info.zen_cpu_features.avx512 == ENABLED, &cpu_var, &tun_var) != 0)
+        return -1;
+    for (size_class_idx sc = SC_SMALL; sc < SIZE_CLASS_COUNT; sc++)
+    {
+        if (cpu_var == CPU_VARIANT_COUNT)
+            impls[sc] = libmem_tun_impls[idx][tun_var];
+        else
+            impls[sc] = (idx < SC_FUNC_COUNT) ? libmem_sc_impls[idx][cpu_var][sc]
+                                              : libmem_cpu_impls[idx][cpu_var];
+    }
+    return 0;
+}
+#endif
+
+static inline void dispatcher_init()
+{
+    func_ptr impls[FUNC_COUNT][SIZE_CLASS_COUNT];
+#ifdef ALMEM_TUNABLES
+    const char *variants[FUNC_COUNT] = {NULL};
+#endif
+
+    libmem_dispatch_resolve(impls);
+#ifdef ALMEM_TUNABLES
+    //per-function variants replace the resolved entries of their function only
+    parse_env_variant_cfg(variants);
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+    {
+        if (variants[idx] != NULL && libmem_variant_impls(idx, variants[idx], impls[idx]) != 0)
+            LOG_WARN("invalid or unsupported variant: %s\n", variants[idx]);
+    }
+#endif
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+        libmem_dispatch_publish(idx, impls[idx]);
+}
+
+#ifdef ALMEM_TUNABLES
+// Kernels the IFUNC resolvers bound the functions to, NULL for the dispatching slots
+static func_ptr libmem_bound_impls[FUNC_COUNT];
+
+/* LIBMEM_DIRECT_BIND=1: the loader binds the functions straight to their kernels,
+ * read from the environment alone. Free of libc: called from the IFUNC resolvers.
+ * returns: true if set
+ */
+static inline bool libmem_direct_bind_cfg(void)
+{
+    const char *bind = get_env_early("LIBMEM_DIRECT_BIND");
+
+    return bind != NULL && bind[0] == '1' && bind[1] == '\0';
+}
+
+/* Kernel of the function for the tunables of the environment, as dispatcher_init()
+ * resolves them, without the size classes: the cpu variant entry serves all the sizes.
+ * The ISA is the one of the Zen generation, zen_info is not filled in yet.
+ * Free of libc: called from the IFUNC resolvers.
+ * returns: function pointer
+ */
+static inline func_ptr libmem_direct_impl(func_index idx)
+{
+    microarch uarch = get_cpu_uarch();
+    bool avx2 = (uarch != UARCH_UNKNOWN), avx512 = (uarch >= ZEN4);
+    cpu_variant_idx cpu_var = (uarch == UARCH_UNKNOWN) ? SYSTEM :
+                              (cpu_variant_idx)(ARCH_ZEN1 + (uarch - ZEN1));
+    tunable_variant_idx tun_var = UNKNOWN;
+    cpu_operation op;
+    alignment src_aln, dst_aln;
+    thresholds th;
+    const char *value;
+
+    value = get_env_early("LIBMEM_OPERATION");
+    if (value != NULL && parse_operation_value(value, &op, &src_aln, &dst_aln) == 0)
+        tun_var = libmem_operation_variant(op, src_aln, dst_aln);
+    else
+    {
+        for (threshold_block blk = TH_MEMCPY; blk < TH_BLOCK_COUNT; blk++)
+        {
+            value = get_env_early(threshold_envs[blk]);
+            if (value != NULL && parse_threshold_block_value(value, blk, &th) == 0)
+                tun_var = THRESHOLD;
+        }
+    }
+    if (tun_var != UNKNOWN && idx < TUN_FUNC_COUNT && libmem_tun_impls[idx][tun_var] != NULL)
+        cpu_var = CPU_VARIANT_COUNT;
+
+    value = get_env_early(variant_envs[idx]);
+    if (value != NULL)
+        libmem_variant_find(idx, value, avx2, avx512, &cpu_var, &tun_var);
+
+    return (cpu_var == CPU_VARIANT_COUNT) ? libmem_tun_impls[idx][tun_var]
+                                          : libmem_cpu_impls[idx][cpu_var];
+}
+
+/* IFUNC resolution of the exported functions: the kernel with LIBMEM_DIRECT_BIND=1,
+ * else the entry jumping through the dispatching slots
+ * returns: function pointer
+ */
+static inline func_ptr libmem_tun_resolve(func_index idx, func_ptr slot_entry)
+{
+    if (!libmem_direct_bind_cfg())
+        return slot_entry;
+    libmem_bound_impls[idx] = libmem_direct_impl(idx);
+    return libmem_bound_impls[idx];
+}
+
+/* Macro to define the ifunc resolvers of the exported functions */
+#define DEF_TUN_IFUNC_RESOLVER(func, idx) \
+extern typeof(*(amd_##func##_fn)0) FN_PROTOTYPE(func); \
+__attribute__((ifunc("libmem_" #func "_resolver"))) \
+    extern typeof(*(amd_##func##_fn)0) func; \
+amd_##func##_fn libmem_##func##_resolver(void) \
+{ \
+    return (amd_##func##_fn) libmem_tun_resolve(idx, (func_ptr) FN_PROTOTYPE(func)); \
+}
+
+DEF_TUN_IFUNC_RESOLVER(memcpy, MEMCPY)
+DEF_TUN_IFUNC_RESOLVER(mempcpy, MEMPCPY)
+DEF_TUN_IFUNC_RESOLVER(memmove, MEMMOVE)
+DEF_TUN_IFUNC_RESOLVER(memset, MEMSET)
+DEF_TUN_IFUNC_RESOLVER(memcmp, MEMCMP)
+DEF_TUN_IFUNC_RESOLVER(memchr, MEMCHR)
+DEF_TUN_IFUNC_RESOLVER(strcpy, STRCPY)
+DEF_TUN_IFUNC_RESOLVER(strncpy, STRNCPY)
+DEF_TUN_IFUNC_RESOLVER(strcmp, STRCMP)
+DEF_TUN_IFUNC_RESOLVER(strncmp, STRNCMP)
+DEF_TUN_IFUNC_RESOLVER(strcat, STRCAT)
+DEF_TUN_IFUNC_RESOLVER(strncat, STRNCAT)
+DEF_TUN_IFUNC_RESOLVER(strstr, STRSTR)
+DEF_TUN_IFUNC_RESOLVER(strlen, STRLEN)
+DEF_TUN_IFUNC_RESOLVER(strnlen, STRNLEN)
+DEF_TUN_IFUNC_RESOLVER(strchr, STRCHR)
+DEF_TUN_IFUNC_RESOLVER(strspn, STRSPN)
+#endif
+
+/* Entry the calls of the function are currently dispatched to: the kernel bound
+ * by the IFUNC resolver, else the large size class entry for the size class
+ * dispatched functions
+ * returns: function pointer
+ */
+static inline func_ptr libmem_dispatched_impl(func_index idx)
+{
+#ifdef ALMEM_TUNABLES
+    if (libmem_bound_impls[idx] != NULL)
+        return libmem_bound_impls[idx];
+#endif
+    switch (idx)
+    {
+        case MEMCPY:    return (func_ptr) _memcpy_sc_variants[SC_BUCKET_COUNT - 1];
+        case MEMPCPY:   return (func_ptr) _mempcpy_sc_variants[SC_BUCKET_COUNT - 1];
+        case MEMMOVE:   return (func_ptr) _memmove_sc_variants[SC_BUCKET_COUNT - 1];
+        case MEMSET:    return (func_ptr) _memset_sc_variants[SC_BUCKET_COUNT - 1];
+        case MEMCMP:    return (func_ptr) _memcmp_variant;
+        case MEMCHR:    return (func_ptr) _memchr_variant;
+        case STRCPY:    return (func_ptr) _strcpy_variant;
+        case STRNCPY:   return (func_ptr) _strncpy_variant;
+        case STRCMP:    return (func_ptr) _strcmp_variant;
+        case STRNCMP:   return (func_ptr) _strncmp_variant;
+        case STRCAT:    return (func_ptr) _strcat_variant;
+        case STRNCAT:   return (func_ptr) _strncat_variant;
+        case STRSTR:    return (func_ptr) _strstr_variant;
+        case STRLEN:    return (func_ptr) _strlen_variant;
+        case STRNLEN:   return (func_ptr) _strnlen_variant;
+        case STRCHR:    return (func_ptr) _strchr_variant;
+        case STRSPN:    return (func_ptr) _strspn_variant;
+        default:        return NULL;
+    }
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2025-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -25,59 +25,26 @@
 
 #include "zen_cpu_info.h"
 #include "libmem_impls.h"
+#include "libmem.h"
 
 
-#if defined(__GNUC__) && (__GNUC__ > 14 && __GNUC_MINOR__ >= 1)
-
+/* Kernels of the Zen generation get_cpu_uarch() detects: CPUID family/model
+ * table or LIBMEM_ARCH override, lowered to the ISA the CPU exposes
+ */
 #define AMD_ZEN_CPU_RESOLVER(func) \
-    __builtin_cpu_init(); \
     do { \
-        if (__builtin_cpu_is("znver5")) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen5); \
-        if (__builtin_cpu_is("znver4")) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen4); \
-        if (__builtin_cpu_is("znver3")) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen3); \
-        if (__builtin_cpu_is("znver2")) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen2); \
-        if (__builtin_cpu_is("znver1")) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen1); \
-        return __ALMEM_CONCAT(__ALMEM_PREFIX(func), system); \
+        switch (get_cpu_uarch()) \
+        { \
+            case ZEN5: return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen5); \
+            case ZEN4: return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen4); \
+            case ZEN3: return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen3); \
+            case ZEN2: return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen2); \
+            case ZEN1: return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen1); \
+            default:   return __ALMEM_CONCAT(__ALMEM_PREFIX(func), system); \
+        } \
     } while (0)
 
 
-#else //Compilers that do not detect the latest architecture: 'znver5'
-
-#define AMD_ZEN_CPU_RESOLVER(func) \
-   do { \
-    uint32_t eax= 0x7;        \
-    uint32_t ebx = 0;         \
-    uint32_t ecx = 0;         \
-    uint32_t edx = 0;         \
-      asm volatile ("cpuid"   \
-     :"=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) \
-     :"0"(eax), "2"(ecx) ); \
-    if (ebx & AVX512_MASK)   \
-    {       \
-         if (ecx & MOVDIRI_MASK) \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen5); \
-         return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen4); \
-    }   \
-    if (ebx & AVX2_MASK) \
-    {   \
-        if (ecx & VPCLMULQDQ_MASK)   \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen3); \
-        else if (ecx & RDPID_MASK)   \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen2); \
-        else if (ecx & RDSEED_MASK)  \
-            return __ALMEM_CONCAT(__ALMEM_PREFIX(func), zen1); \
-    }   \
-    return __ALMEM_CONCAT(__ALMEM_PREFIX(func), system); \
-} while(0)
-
-#endif
-
-
 /* Macro to define ifunc resolver functions using predefined typedefs */
 #define DEF_IFUNC_RESOLVER(func) \
 __attribute__((ifunc("libmem_" #func "_resolver"))) \
@@ -105,3 +72,31 @@ DEF_IFUNC_RESOLVER(strlen)
 DEF_IFUNC_RESOLVER(strnlen)
 DEF_IFUNC_RESOLVER(strchr)
 DEF_IFUNC_RESOLVER(strspn)
+
+/* Entry the loader bound the function to
+ * returns: function pointer
+ */
+static inline func_ptr libmem_dispatched_impl(func_index idx)
+{
+    switch (idx)
+    {
+        case MEMCPY:    return (func_ptr) libmem_memcpy_resolver();
+        case MEMPCPY:   return (func_ptr) libmem_mempcpy_resolver();
+        case MEMMOVE:   return (func_ptr) libmem_memmove_resolver();
+        case MEMSET:    return (func_ptr) libmem_memset_resolver();
+        case MEMCMP:    return (func_ptr) libmem_memcmp_resolver();
+        case MEMCHR:    return (func_ptr) libmem_memchr_resolver();
+        case STRCPY:    return (func_ptr) libmem_strcpy_resolver();
+        case STRNCPY:   return (func_ptr) libmem_strncpy_resolver();
+        case STRCMP:    return (func_ptr) libmem_strcmp_resolver();
+        case STRNCMP:   return (func_ptr) libmem_strncmp_resolver();
+        case STRCAT:    return (func_ptr) libmem_strcat_resolver();
+        case STRNCAT:   return (func_ptr) libmem_strncat_resolver();
+        case STRSTR:    return (func_ptr) libmem_strstr_resolver();
+        case STRLEN:    return (func_ptr) libmem_strlen_resolver();
+        case STRNLEN:   return (func_ptr) libmem_strnlen_resolver();
+        case STRCHR:    return (func_ptr) libmem_strchr_resolver();
+        case STRSPN:    return (func_ptr) libmem_strspn_resolver();
+        default:        return NULL;
+    }
+}
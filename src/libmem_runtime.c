@@ -0,0 +1,289 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "libmem_api.h"
+#include "threshold.h"
+#include "zen_cpu_info.h"
+
+extern cpu_info zen_info;
+
+static const char * const libmem_func_names[LIBMEM_FUNC_COUNT] =
+{
+    "memcpy", "mempcpy", "memmove", "memset", "memcmp", "memchr",
+    "strcpy", "strncpy", "strcmp", "strncmp", "strcat", "strncat",
+    "strstr", "strlen", "strnlen", "strchr", "strspn"
+};
+
+#ifdef ALMEM_DYN_DISPATCH
+/* Looks up the dispatched entry of the function in the dispatching tables
+ * returns: variant name
+ */
+static inline const char *libmem_variant_name(func_index idx)
+{
+    func_ptr impl = libmem_dispatched_impl(idx);
+
+#ifdef ALMEM_TUNABLES
+    impl = stats_unwrap(idx, impl);
+    impl = canary_unwrap(idx, impl);
+    impl = experiment_unwrap(idx, impl);
+    impl = adaptive_unwrap(idx, impl);
+#endif
+    for (cpu_variant_idx var = ARCH_ZEN1; var < CPU_VARIANT_COUNT; var++)
+    {
+#ifdef ALMEM_TUNABLES
+        if (idx < SC_FUNC_COUNT && impl == libmem_sc_impls[idx][var][SC_LARGE])
+            return libmem_cpu_variant_names[var];
+#endif
+        // kernels bound by the IFUNC resolvers
+        if (impl == libmem_cpu_impls[idx][var])
+            return libmem_cpu_variant_names[var];
+    }
+#ifdef ALMEM_TUNABLES
+    for (tunable_variant_idx var = AVX2_UNALIGNED; var < TUN_VARIANT_COUNT; var++)
+    {
+        if (impl == libmem_tun_impls[idx][var])
+            return libmem_tun_variant_names[var];
+    }
+#endif
+    return "unknown";
+}
+#endif
+
+/* Rebinds the function to the named variant
+ * returns: 0 on success, -1 on failure
+ */
+int libmem_set_variant(libmem_func func, const char *variant)
+{
+#ifdef ALMEM_TUNABLES
+    func_ptr impls[SIZE_CLASS_COUNT];
+
+    if ((unsigned int) func >= LIBMEM_FUNC_COUNT || variant == NULL)
+        return -1;
+
+    // LIBMEM_DIRECT_BIND: the loader bound the function to its kernel
+    if (libmem_bound_impls[func] != NULL)
+        return -1;
+
+    if (libmem_variant_impls((func_index) func, variant, impls) != 0)
+        return -1;
+
+    libmem_update_begin();
+    libmem_dispatch_publish((func_index) func, impls);
+    // the new entries stay under verification
+    if (canary_rate != 0)
+        canary_bind((func_index) func);
+    if (stats_enabled != STATS_OFF)
+        stats_bind((func_index) func);
+    libmem_update_end();
+    return 0;
+#else
+    // IFUNC and static builds bind the functions at load/link time
+    (void) func;
+    (void) variant;
+    return -1;
+#endif
+}
+
+/* Replaces the thresholds used by the kernels
+ * returns: 0 on success, -1 on invalid thresholds
+ */
+int libmem_set_thresholds(const libmem_thresholds *thresholds)
+{
+    if (thresholds == NULL)
+        return -1;
+
+    if (thresholds->repmov_start_threshold > thresholds->repmov_stop_threshold
+        || thresholds->repstore_start_threshold > thresholds->repstore_stop_threshold
+        || thresholds->nt_start_threshold > thresholds->nt_stop_threshold)
+        return -1;
+
+    libmem_update_begin();
+#ifdef ALMEM_TUNABLES
+    // explicit thresholds are not adapted any further
+    adaptive_stop();
+#endif
+    // explicit thresholds apply to every core class
+    __atomic_store_n(&__core_class_count, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repmov_start_threshold,
+                        thresholds->repmov_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repmov_stop_threshold,
+                        thresholds->repmov_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repstore_start_threshold,
+                        thresholds->repstore_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repstore_stop_threshold,
+                        thresholds->repstore_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_start_threshold,
+                        thresholds->nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_stop_threshold,
+                        thresholds->nt_stop_threshold, __ATOMIC_RELEASE);
+    // memmove and the memset non-temporal stores follow the memcpy thresholds
+    __atomic_store_n(&__memmove_repmov_start_threshold,
+                        thresholds->repmov_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_repmov_stop_threshold,
+                        thresholds->repmov_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_nt_start_threshold,
+                        thresholds->nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_nt_stop_threshold,
+                        thresholds->nt_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_store_start_threshold,
+                        thresholds->nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_store_stop_threshold,
+                        thresholds->nt_stop_threshold, __ATOMIC_RELEASE);
+    libmem_update_end();
+    return 0;
+}
+
+/* Re-reads the config file and the environment, then publishes the thresholds
+ * and the dispatching entries of the new configuration
+ * returns: 0 on success, -1 on non-tunables builds
+ */
+int libmem_reload(void)
+{
+#ifdef ALMEM_TUNABLES
+    libmem_update_begin();
+    // the reloaded thresholds are not adapted any further
+    adaptive_stop();
+
+    user_config.user_operation = (cpu_operation){0};
+    user_config.user_threshold_blocks = 0;
+    user_config.src_aln = u_align;
+    user_config.dst_aln = u_align;
+    active_operation_cfg = SYS_CFG;
+    active_threshold_cfg = SYS_CFG;
+    // load time settings, they may point into the config file read earlier
+    user_config.sysfs_root = NULL;
+    user_config.calib_file = NULL;
+
+    parse_env_config_cfg();
+    parse_env_operation_cfg();
+    if (active_operation_cfg == SYS_CFG)
+        parse_env_threshold_cfg();
+
+    // user thresholds apply to every core class
+    __atomic_store_n(&__core_class_count,
+                        (active_operation_cfg == SYS_CFG && active_threshold_cfg == SYS_CFG) ?
+                        __sys_core_class_count : 1, __ATOMIC_RELEASE);
+    configure_thresholds();
+    dispatcher_init();
+    // the new entries stay under verification
+    if (canary_rate != 0)
+    {
+        for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+            canary_bind(idx);
+    }
+    if (stats_enabled != STATS_OFF)
+    {
+        for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+            stats_bind(idx);
+    }
+    libmem_update_end();
+    return 0;
+#else
+    // IFUNC and static builds bind the functions at load/link time
+    return -1;
+#endif
+}
+
+/* Writes the report of the LIBMEM_EXPERIMENT A/B experiment
+ * returns: 0 on success, -1 without experiment or on write failure
+ */
+int libmem_experiment_report(int fd)
+{
+#ifdef ALMEM_TUNABLES
+    return experiment_report(fd);
+#else
+    (void) fd;
+    return -1;
+#endif
+}
+
+/* Writes the checked calls and divergences of the LIBMEM_CANARY verification
+ * returns: 0 on success, -1 without verification or on write failure
+ */
+int libmem_canary_report(int fd)
+{
+#ifdef ALMEM_TUNABLES
+    return canary_report(fd);
+#else
+    (void) fd;
+    return -1;
+#endif
+}
+
+/* Writes the calls counted by LIBMEM_STATS per size and alignment
+ * returns: 0 on success, -1 without statistics or on write failure
+ */
+int libmem_stats_report(int fd)
+{
+#ifdef ALMEM_TUNABLES
+    return stats_report(fd);
+#else
+    (void) fd;
+    return -1;
+#endif
+}
+
+/* Fills the runtime configuration of the library
+ * returns: 0 on success, -1 if info is NULL
+ */
+int libmem_get_runtime_info(libmem_runtime_info *info)
+{
+    if (info == NULL)
+        return -1;
+
+    info->l1d_size = zen_info.zen_cache_info.l1d_per_core;
+    info->l2_size = zen_info.zen_cache_info.l2_per_core;
+    info->l3_size = zen_info.zen_cache_info.l3_per_ccx;
+
+    info->repmov_start_threshold = __repmov_start_threshold;
+    info->repmov_stop_threshold = __repmov_stop_threshold;
+    info->repstore_start_threshold = __repstore_start_threshold;
+    info->repstore_stop_threshold = __repstore_stop_threshold;
+    info->nt_start_threshold = __nt_start_threshold;
+    info->nt_stop_threshold = __nt_stop_threshold;
+
+    for (int idx = 0; idx < LIBMEM_FUNC_COUNT; idx++)
+    {
+        info->funcs[idx].func = libmem_func_names[idx];
+#ifdef ALMEM_DYN_DISPATCH
+        info->funcs[idx].variant = libmem_variant_name((func_index) idx);
+#elif defined(ALMEM_STATIC_VARIANT)
+        info->funcs[idx].variant = ALMEM_STATIC_VARIANT;
+#else
+        info->funcs[idx].variant = "system";
+#endif
+    }
+
+#ifdef ALMEM_TUNABLES
+    info->uarch = libmem_cpu_variant_names[libmem_cpu_var_idx];
+#else
+    // all the functions are bound to the same cpu variant
+    info->uarch = info->funcs[LIBMEM_MEMCPY].variant;
+#endif
+    return 0;
+}
@@ -0,0 +1,356 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+/*
+ * Call statistics (LIBMEM_STATS=1|shm): every function is bound to a stats
+ * entry counting the call in the slot of the thread before forwarding to the
+ * entry dispatched before. A thread claims its slot of the segment on its
+ * first call and is its only writer: the counters are plain increments of
+ * cache lines no other thread writes, readers sum the slots of the threads.
+ * The segment is anonymous memory written to stderr at exit (LIBMEM_STATS=1)
+ * or the file /dev/shm/libmem-<pid> polled by libmem_stats (LIBMEM_STATS=shm),
+ * laid out as in libmem_api.h and removed at exit.
+ * Functions rebound by libmem_set_variant() or libmem_reload() are bound to
+ * their stats entry again, forwarding to the new entries.
+ */
+
+#define STATS_PATH_SZ       32
+#define STATS_LINE_SZ       128
+#define STATS_BKT(size)     (63 - __builtin_clzl((size) | 1))
+#define STATS_ALN(ptr)      ((uintptr_t)(ptr) & (LIBMEM_STATS_ALIGN_BUCKETS - 1))
+
+static stats_mode stats_enabled;            //STATS_OFF when the statistics are off
+static const char * const *stats_func_names;
+static func_ptr stats_impls[FUNC_COUNT][SC_BUCKET_COUNT];
+static libmem_stats_header *stats_seg;
+static libmem_stats_thread *stats_slots;
+static char stats_path[STATS_PATH_SZ];
+
+// slot of the thread, NULL until its first call
+static __thread libmem_stats_thread *stats_slot __attribute__((tls_model("initial-exec")));
+
+/* Claims the next slot of the segment, on the first call of the thread
+ * returns: slot of the thread
+ */
+static __attribute__((noinline)) libmem_stats_thread *stats_thread_slot(void)
+{
+    uint32_t tid = __atomic_fetch_add(&stats_seg->threads, 1, __ATOMIC_RELAXED);
+
+    // threads beyond the slots share the last one, racing on its counters
+    if (tid >= stats_seg->thread_max)
+        tid = stats_seg->thread_max - 1;
+    stats_slot = &stats_slots[tid];
+    return stats_slot;
+}
+
+static inline libmem_stats_func *stats_func(func_index idx)
+{
+    libmem_stats_thread *slot = stats_slot;
+
+    if (unlikely(slot == NULL))
+        slot = stats_thread_slot();
+    return &slot->funcs[idx];
+}
+
+/* Stats entries of the functions: count the size of the call, if known
+ * before the call, and the alignment of its buffers, then forward to the
+ * entry of the size bucket of the call (the first one of the functions
+ * dispatched on a single entry)
+ */
+#define STATS_ENTRY(func, FUNC, ret_t, params, args, bkt, count)    \
+    static ret_t __##func##_stats params                            \
+    {                                                               \
+        libmem_stats_func *stats = stats_func(FUNC);                \
+        count                                                       \
+        return ((amd_##func##_fn) stats_impls[FUNC][bkt]) args;     \
+    }
+
+// Stats entries of the functions sized by their result, counted once it returns
+#define STATS_RET_ENTRY(func, FUNC, ret_t, params, args, count)     \
+    static ret_t __##func##_stats params                            \
+    {                                                               \
+        libmem_stats_func *stats = stats_func(FUNC);                \
+        ret_t ret = ((amd_##func##_fn) stats_impls[FUNC][0]) args;  \
+        count                                                       \
+        return ret;                                                 \
+    }
+
+#define STATS_SIZE(len)     stats->size[STATS_BKT(len)]++
+#define STATS_DST(ptr)      stats->dst_align[STATS_ALN(ptr)]++
+#define STATS_SRC(ptr)      stats->src_align[STATS_ALN(ptr)]++
+
+STATS_ENTRY(memcpy, MEMCPY, void *, (void *dst, const void *src, size_t size),
+            (dst, src, size), STATS_BKT(size), { STATS_SIZE(size); STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(mempcpy, MEMPCPY, void *, (void *dst, const void *src, size_t size),
+            (dst, src, size), STATS_BKT(size), { STATS_SIZE(size); STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(memmove, MEMMOVE, void *, (void *dst, const void *src, size_t size),
+            (dst, src, size), STATS_BKT(size), { STATS_SIZE(size); STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(memset, MEMSET, void *, (void *mem, int val, size_t size),
+            (mem, val, size), STATS_BKT(size), { STATS_SIZE(size); STATS_DST(mem); })
+STATS_ENTRY(memcmp, MEMCMP, int, (const void *mem1, const void *mem2, size_t size),
+            (mem1, mem2, size), 0, { STATS_SIZE(size); STATS_DST(mem1); STATS_SRC(mem2); })
+STATS_ENTRY(memchr, MEMCHR, void *, (const void *mem, int val, size_t size),
+            (mem, val, size), 0, { STATS_SIZE(size); STATS_DST(mem); })
+STATS_ENTRY(strcpy, STRCPY, char *, (char *dst, const char *src),
+            (dst, src), 0, { STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(strncpy, STRNCPY, char *, (char *dst, const char *src, size_t size),
+            (dst, src, size), 0, { STATS_SIZE(size); STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(strcmp, STRCMP, int, (const char *str1, const char *str2),
+            (str1, str2), 0, { STATS_DST(str1); STATS_SRC(str2); })
+STATS_ENTRY(strncmp, STRNCMP, int, (const char *str1, const char *str2, size_t size),
+            (str1, str2, size), 0, { STATS_SIZE(size); STATS_DST(str1); STATS_SRC(str2); })
+STATS_ENTRY(strcat, STRCAT, char *, (char *dst, const char *src),
+            (dst, src), 0, { STATS_DST(dst); STATS_SRC(src); })
+STATS_ENTRY(strncat, STRNCAT, char *, (char *dst, const char *src, size_t size),
+            (dst, src, size), 0, { STATS_SIZE(size); STATS_DST(dst); STATS_SRC(src); })
+STATS_RET_ENTRY(strstr, STRSTR, char *, (const char *str, const char *sub), (str, sub),
+                { if (ret != NULL) STATS_SIZE(ret - str); STATS_DST(str); STATS_SRC(sub); })
+STATS_RET_ENTRY(strlen, STRLEN, size_t, (const char *str), (str),
+                { STATS_SIZE(ret); STATS_DST(str); })
+STATS_RET_ENTRY(strnlen, STRNLEN, size_t, (const char *str, size_t size), (str, size),
+                { STATS_SIZE(ret); STATS_DST(str); })
+STATS_RET_ENTRY(strchr, STRCHR, char *, (const char *str, int val), (str, val),
+                { if (ret != NULL) STATS_SIZE(ret - str); STATS_DST(str); })
+STATS_RET_ENTRY(strspn, STRSPN, size_t, (const char *str, const char *accept), (str, accept),
+                { STATS_SIZE(ret); STATS_DST(str); STATS_SRC(accept); })
+
+static const func_ptr stats_entries[FUNC_COUNT] =
+{
+    [MEMCPY]    = (func_ptr) __memcpy_stats,
+    [MEMPCPY]   = (func_ptr) __mempcpy_stats,
+    [MEMMOVE]   = (func_ptr) __memmove_stats,
+    [MEMSET]    = (func_ptr) __memset_stats,
+    [MEMCMP]    = (func_ptr) __memcmp_stats,
+    [MEMCHR]    = (func_ptr) __memchr_stats,
+    [STRCPY]    = (func_ptr) __strcpy_stats,
+    [STRNCPY]   = (func_ptr) __strncpy_stats,
+    [STRCMP]    = (func_ptr) __strcmp_stats,
+    [STRNCMP]   = (func_ptr) __strncmp_stats,
+    [STRCAT]    = (func_ptr) __strcat_stats,
+    [STRNCAT]   = (func_ptr) __strncat_stats,
+    [STRSTR]    = (func_ptr) __strstr_stats,
+    [STRLEN]    = (func_ptr) __strlen_stats,
+    [STRNLEN]   = (func_ptr) __strnlen_stats,
+    [STRCHR]    = (func_ptr) __strchr_stats,
+    [STRSPN]    = (func_ptr) __strspn_stats,
+};
+
+/* Entry the calls of the bucket are counted for, seen through the stats entry
+ * returns: function pointer
+ */
+static inline func_ptr stats_unwrap(func_index idx, func_ptr impl)
+{
+    if (stats_enabled != STATS_OFF && impl == stats_entries[idx])
+        return stats_impls[idx][(idx < SC_FUNC_COUNT) ? SC_BUCKET_COUNT - 1 : 0];
+    return impl;
+}
+
+/* Sums the counters of the function over the slots of the threads
+ * returns: calls of the function
+ */
+static inline uint64_t stats_sum(func_index idx, libmem_stats_func *sum)
+{
+    uint32_t threads = __atomic_load_n(&stats_seg->threads, __ATOMIC_RELAXED);
+    const libmem_stats_func *stats;
+    uint64_t calls = 0;
+
+    if (threads > stats_seg->thread_max)
+        threads = stats_seg->thread_max;
+    *sum = (libmem_stats_func){0};
+    for (uint32_t tid = 0; tid < threads; tid++)
+    {
+        stats = &stats_slots[tid].funcs[idx];
+        for (uint32_t bkt = 0; bkt < LIBMEM_STATS_SIZE_BUCKETS; bkt++)
+            sum->size[bkt] += __atomic_load_n(&stats->size[bkt], __ATOMIC_RELAXED);
+        for (uint32_t aln = 0; aln < LIBMEM_STATS_ALIGN_BUCKETS; aln++)
+        {
+            sum->dst_align[aln] += __atomic_load_n(&stats->dst_align[aln], __ATOMIC_RELAXED);
+            sum->src_align[aln] += __atomic_load_n(&stats->src_align[aln], __ATOMIC_RELAXED);
+        }
+    }
+    // every call counts the alignment of its first buffer
+    for (uint32_t aln = 0; aln < LIBMEM_STATS_ALIGN_BUCKETS; aln++)
+        calls += sum->dst_align[aln];
+    return calls;
+}
+
+/* Writes, per function called, the calls per power of two size and per
+ * alignment of the buffers, the offsets in the cache line folded into the
+ * largest power of two dividing them
+ * returns: 0 on success, -1 without statistics or on write failure
+ */
+static inline int stats_report(int fd)
+{
+    uint64_t calls, sized, dst_aln[7], src_aln[7];
+    char line[STATS_LINE_SZ];
+    libmem_stats_func sum;
+    uint32_t shift;
+    int len;
+
+    if (stats_enabled == STATS_OFF)
+        return -1;
+
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+    {
+        calls = stats_sum(idx, &sum);
+        if (calls == 0)
+            continue;
+        len = snprintf(line, STATS_LINE_SZ, "libmem stats: %-8s %12lu calls\n",
+                       stats_func_names[idx], calls);
+        if (write(fd, line, len) != len)
+            return -1;
+
+        sized = 0;
+        for (uint32_t bkt = 0; bkt < LIBMEM_STATS_SIZE_BUCKETS; bkt++)
+        {
+            if (sum.size[bkt] == 0)
+                continue;
+            sized += sum.size[bkt];
+            len = snprintf(line, STATS_LINE_SZ, "libmem stats: %-8s size %10lu-%-10lu %12lu\n",
+                           stats_func_names[idx], bkt ? 1UL << bkt : 0,
+                           (1UL << bkt) - 1 + (1UL << bkt), sum.size[bkt]);
+            if (write(fd, line, len) != len)
+                return -1;
+        }
+        if (sized != calls)
+        {
+            len = snprintf(line, STATS_LINE_SZ, "libmem stats: %-8s size %-21s %12lu\n",
+                           stats_func_names[idx], "unknown", calls - sized);
+            if (write(fd, line, len) != len)
+                return -1;
+        }
+
+        for (shift = 0; shift < 7; shift++)
+            dst_aln[shift] = src_aln[shift] = 0;
+        for (uint32_t aln = 0; aln < LIBMEM_STATS_ALIGN_BUCKETS; aln++)
+        {
+            shift = aln ? __builtin_ctz(aln) : 6;
+            dst_aln[shift] += sum.dst_align[aln];
+            src_aln[shift] += sum.src_align[aln];
+        }
+        for (shift = 7; shift-- > 0;)
+        {
+            if (dst_aln[shift] == 0 && src_aln[shift] == 0)
+                continue;
+            len = snprintf(line, STATS_LINE_SZ, "libmem stats: %-8s %2uB aligned dst %12lu src %12lu\n",
+                           stats_func_names[idx], 1U << shift, dst_aln[shift], src_aln[shift]);
+            if (write(fd, line, len) != len)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* Binds the function to its stats entry, forwarding to the entries it is
+ * dispatched to
+ * returns: void
+ */
+static inline void stats_bind(func_index idx)
+{
+    size_t buckets = (idx < SC_FUNC_COUNT) ? SC_BUCKET_COUNT : 1;
+
+    for (size_t bkt = 0; bkt < buckets; bkt++)
+        stats_impls[idx][bkt] = libmem_dispatch_slots[idx][bkt];
+    for (size_t bkt = 0; bkt < buckets; bkt++)
+        __atomic_store_n(&libmem_dispatch_slots[idx][bkt], stats_entries[idx], __ATOMIC_RELEASE);
+}
+
+// The thread forking into a child counts into a new slot of the segment
+static void stats_fork_child(void)
+{
+    stats_slot = NULL;
+}
+
+/* Maps the segment of the statistics, the file of the process with
+ * STATS_SHM
+ * returns: segment, NULL on failure
+ */
+static inline libmem_stats_header *stats_map(stats_mode mode, size_t size)
+{
+    libmem_stats_header *seg;
+    int fd;
+
+    if (mode != STATS_SHM)
+    {
+        seg = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return (seg == MAP_FAILED) ? NULL : seg;
+    }
+
+    snprintf(stats_path, STATS_PATH_SZ, "/dev/shm/libmem-%d", getpid());
+    fd = open(stats_path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return NULL;
+    // the pages of the slots no thread claims are never allocated
+    if (ftruncate(fd, size) != 0)
+        seg = MAP_FAILED;
+    else
+        seg = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (seg != MAP_FAILED)
+        return seg;
+    unlink(stats_path);
+    return NULL;
+}
+
+/* Binds every function to its stats entry, counting into the segment
+ * returns: void
+ */
+static inline void configure_stats(stats_mode mode, const char * const *func_names)
+{
+    size_t size = sizeof(libmem_stats_header) + LIBMEM_STATS_THREADS * sizeof(libmem_stats_thread);
+
+    stats_seg = stats_map(mode, size);
+    if (stats_seg == NULL)
+    {
+        LOG_WARN("Failed to map the call statistics\n");
+        return;
+    }
+    stats_slots = (libmem_stats_thread *)(stats_seg + 1);
+    stats_seg->version = LIBMEM_STATS_VERSION;
+    stats_seg->pid = getpid();
+    stats_seg->thread_max = LIBMEM_STATS_THREADS;
+    // readers check the magic for a complete header
+    __atomic_store_n(&stats_seg->magic, LIBMEM_STATS_MAGIC, __ATOMIC_RELEASE);
+    pthread_atfork(NULL, NULL, stats_fork_child);
+
+    stats_func_names = func_names;
+    stats_enabled = mode;
+    for (func_index idx = MEMCPY; idx < FUNC_COUNT; idx++)
+        stats_bind(idx);
+    LOG_INFO("Call statistics %s\n", (mode == STATS_SHM) ? stats_path : "reported at exit");
+}
+
+static __attribute__((destructor)) void stats_fini(void)
+{
+    if (stats_enabled == STATS_EXIT)
+        stats_report(STDERR_FILENO);
+    // forked children leave the file of the parent
+    else if (stats_enabled == STATS_SHM && stats_seg->pid == (uint32_t)getpid())
+        unlink(stats_path);
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,23 +23,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 
 void * __attribute__((flatten)) __memchr_system(const void * mem, int val, size_t size)
 {
     LOG_INFO("\n");
-    void * (*system_memchr)(const void *, int, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-
-    if (handle)
-    {
-        system_memchr = dlsym(handle, "memchr");
-        dlclose(handle);
-        if (system_memchr != NULL)
-            return system_memchr(mem, val, size);
-    }
-    return NULL;
+    return SYSTEM_IMPL(memchr)(mem, val, size);
 }
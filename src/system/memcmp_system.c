@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,23 +23,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 
 int __attribute__((flatten)) __memcmp_system(const void * mem1, const void * mem2, size_t size)
 {
     LOG_INFO("\n");
-    int (*system_memcmp)(const void *, const void *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-
-    if (handle)
-    {
-        system_memcmp = dlsym(handle, "memcmp");
-        dlclose(handle);
-        if (system_memcmp != NULL)
-            return system_memcmp(mem1, mem2, size);
-    }
-    return -1;
+    return SYSTEM_IMPL(memcmp)(mem1, mem2, size);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,24 +23,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 
 void * __attribute__((flatten)) __memcpy_system(void * __restrict dst,
                         const void * __restrict src, size_t size)
 {
     LOG_INFO("\n");
-    void * (*system_memcpy)(void *, const void *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-
-    if (handle)
-    {
-        system_memcpy = dlsym(handle, "memcpy");
-        dlclose(handle);
-        if (system_memcpy != NULL)
-            return system_memcpy(dst,src, size);
-    }
-    return NULL;
+    return SYSTEM_IMPL(memcpy)(dst, src, size);
 }
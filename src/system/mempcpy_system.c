@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,24 +23,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 
 void * __attribute__((flatten)) __mempcpy_system(void * __restrict dst,
                         const void * __restrict src, size_t size)
 {
     LOG_INFO("\n");
-    void * (*system_mempcpy)(void *, const void *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-
-    if (handle)
-    {
-        system_mempcpy = dlsym(handle, "mempcpy");
-        dlclose(handle);
-        if (system_mempcpy != NULL)
-            return system_mempcpy(dst,src, size);
-    }
-    return NULL;
+    return SYSTEM_IMPL(mempcpy)(dst, src, size);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,22 +23,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 char * __attribute__((flatten)) __strcat_system(char * __restrict dst,
                         const char * __restrict src)
 {
     LOG_INFO("\n");
-    char * (*system_strcat)(char *, const char *);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strcat = dlsym(handle, "strcat");
-        dlclose(handle);
-        if (system_strcat != NULL)
-            return system_strcat(dst, src);
-    }
-    return NULL;
+    return SYSTEM_IMPL(strcat)(dst, src);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,21 +23,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 char* __attribute__((flatten)) __strchr_system(const char * str, int c)
 {
     LOG_INFO("\n");
-    char* (*system_strchr)(const char *, int);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strchr = dlsym(handle, "strchr");
-        dlclose(handle);
-        if (system_strchr != NULL)
-            return system_strchr(str, c);
-    }
-    return NULL;
+    return SYSTEM_IMPL(strchr)(str, c);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,24 +23,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
-#define STRCMP_ERROR __INT32_MAX__
 
 int __attribute__((flatten)) __strcmp_system(const char * __restrict str1,
                         const char * __restrict str2)
 {
     LOG_INFO("\n");
-    int (*system_strcmp)(const char *, const char *);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strcmp = dlsym(handle, "strcmp");
-        dlclose(handle);
-        if (system_strcmp != NULL)
-            return system_strcmp(str1, str2);
-    }
-    return STRCMP_ERROR;
+    return SYSTEM_IMPL(strcmp)(str1, str2);
 }
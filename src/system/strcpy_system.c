@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,24 +23,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 
 char * __attribute__((flatten)) __strcpy_system(char * __restrict dst,
                         const char * __restrict src)
 {
     LOG_INFO("\n");
-    char * (*system_strcpy)(char *, const char *);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-
-    if (handle)
-    {
-        system_strcpy = dlsym(handle, "strcpy");
-        dlclose(handle);
-        if (system_strcpy != NULL)
-            return system_strcpy(dst, src);
-    }
-    return NULL;
+    return SYSTEM_IMPL(strcpy)(dst, src);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,21 +23,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 size_t __attribute__((flatten)) __strlen_system(const char * str)
 {
     LOG_INFO("\n");
-    size_t (*system_strlen)(const char *);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strlen = dlsym(handle, "strlen");
-        dlclose(handle);
-        if (system_strlen != NULL)
-            return system_strlen(str);
-    }
-    return -1;
+    return SYSTEM_IMPL(strlen)(str);
 }
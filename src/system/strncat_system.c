@@ -1,4 +1,4 @@
-/* Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2025-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,22 +23,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 char * __attribute__((flatten)) __strncat_system(char * __restrict dst,
                         const char * __restrict src, size_t n)
 {
     LOG_INFO("\n");
-    char * (*system_strncat)(char *, const char *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strncat = dlsym(handle, "strncat");
-        dlclose(handle);
-        if (system_strncat != NULL)
-            return system_strncat(dst, src, n);
-    }
-    return NULL;
+    return SYSTEM_IMPL(strncat)(dst, src, n);
 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -23,23 +23,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
-#define STRNCMP_ERROR __INT32_MAX__
 int __attribute__((flatten)) __strncmp_system(const char * __restrict str1,
                         const char * __restrict str2, size_t size)
 {
     LOG_INFO("\n");
-    int (*system_strncmp)(const char *, const char *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strncmp = dlsym(handle, "strncmp");
-        dlclose(handle);
-        if (system_strncmp != NULL)
-            return system_strncmp(str1, str2, size);
-    }
-    return STRNCMP_ERROR;
+    return SYSTEM_IMPL(strncmp)(str1, str2, size);
 }
@@ -23,21 +23,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
+#include "system_impls.h"
 #include <stddef.h>
-#include <gnu/lib-names.h>
 size_t __attribute__((flatten)) __strnlen_system(const char * str, size_t maxlen)
 {
     LOG_INFO("\n");
-    size_t (*system_strnlen)(const char *, size_t);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strnlen = dlsym(handle, "strnlen");
-        dlclose(handle);
-        if (system_strnlen != NULL)
-            return system_strnlen(str, maxlen);
-    }
-    return maxlen;
+    return SYSTEM_IMPL(strnlen)(str, maxlen);
 }
@@ -23,21 +23,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "logger.h"
-#include <dlfcn.h>
-#include <gnu/lib-names.h>
+#include "system_impls.h"
 #include <stddef.h>
 size_t __attribute__((flatten)) __strspn_system(const char *__restrict str, const char *__restrict accept)
 {
     LOG_INFO("\n");
-    size_t (*system_strspn)(const char *, const char *);
-    void *handle = NULL;
-    handle = dlopen(LIBC_SO, RTLD_LAZY);
-    if (handle)
-    {
-        system_strspn = dlsym(handle, "strspn");
-        dlclose(handle);
-        if (system_strspn != NULL)
-            return system_strspn(str, accept);
-    }
-    return 0;
+    return SYSTEM_IMPL(strspn)(str, accept);
 }
@@ -0,0 +1,71 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "logger.h"
+#include "system_impls.h"
+#include <dlfcn.h>
+#include <stddef.h>
+#include <gnu/lib-names.h>
+
+HIDDEN_SYMBOL system_impls __system_impls;
+
+#define RESOLVE_SYSTEM_IMPL(handle, fn) \
+    __system_impls.fn##_fn = (amd_##fn##_fn) dlsym(handle, #fn)
+
+/* Looks up all the glibc fallbacks with a single dlopen of LIBC_SO.
+ * libc is already mapped into every process, so the handle is only used
+ * for the symbol lookups; the resolved addresses stay valid after dlclose.
+ */
+HIDDEN_SYMBOL void __system_impls_init(void)
+{
+    void *handle = NULL;
+
+    handle = dlopen(LIBC_SO, RTLD_LAZY | RTLD_NOLOAD);
+    if (handle == NULL)
+    {
+        LOG_CRITICAL("Failed to open %s\n", LIBC_SO);
+        return;
+    }
+
+    RESOLVE_SYSTEM_IMPL(handle, memcpy);
+    RESOLVE_SYSTEM_IMPL(handle, mempcpy);
+    RESOLVE_SYSTEM_IMPL(handle, memmove);
+    RESOLVE_SYSTEM_IMPL(handle, memset);
+    RESOLVE_SYSTEM_IMPL(handle, memcmp);
+    RESOLVE_SYSTEM_IMPL(handle, memchr);
+    RESOLVE_SYSTEM_IMPL(handle, strcpy);
+    RESOLVE_SYSTEM_IMPL(handle, strncpy);
+    RESOLVE_SYSTEM_IMPL(handle, strcmp);
+    RESOLVE_SYSTEM_IMPL(handle, strncmp);
+    RESOLVE_SYSTEM_IMPL(handle, strcat);
+    RESOLVE_SYSTEM_IMPL(handle, strncat);
+    RESOLVE_SYSTEM_IMPL(handle, strstr);
+    RESOLVE_SYSTEM_IMPL(handle, strlen);
+    RESOLVE_SYSTEM_IMPL(handle, strnlen);
+    RESOLVE_SYSTEM_IMPL(handle, strchr);
+    RESOLVE_SYSTEM_IMPL(handle, strspn);
+
+    dlclose(handle);
+    LOG_INFO("Resolved system implementations from %s\n", LIBC_SO);
+}
@@ -33,55 +33,328 @@ HIDDEN_SYMBOL uint64_t __repstore_start_threshold __attribute__((aligned(64))) =
 HIDDEN_SYMBOL uint64_t __repstore_stop_threshold __attribute__((aligned(64))) = 0xffffffff;
 HIDDEN_SYMBOL uint64_t __nt_start_threshold __attribute__((aligned(64))) = 0xffffffff;
 HIDDEN_SYMBOL uint64_t __nt_stop_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __memmove_repmov_start_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __memmove_repmov_stop_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __memmove_nt_start_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __memmove_nt_stop_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __nt_store_start_threshold __attribute__((aligned(64))) = 0xffffffff;
+HIDDEN_SYMBOL uint64_t __nt_store_stop_threshold __attribute__((aligned(64))) = 0xffffffff;
+
+HIDDEN_SYMBOL uint32_t __core_class_count __attribute__((aligned(64))) = 1;
+HIDDEN_SYMBOL core_class_thresholds __core_class_thresholds[CORE_CLASS_MAX] __attribute__((aligned(64)));
+HIDDEN_SYMBOL uint8_t __cpu_core_class[CORE_CLASS_CPU_MAX] __attribute__((aligned(64)));
+// Core classes of the system thresholds, restored by the reloads of the system config
+static uint32_t __sys_core_class_count = 1;
+
+// Serializes the runtime updates of the dispatching slots and thresholds
+static bool libmem_update_lock;
+
+static inline void libmem_update_begin(void)
+{
+    while (__atomic_test_and_set(&libmem_update_lock, __ATOMIC_ACQUIRE))
+        __builtin_ia32_pause();
+}
+
+static inline void libmem_update_end(void)
+{
+    __atomic_clear(&libmem_update_lock, __ATOMIC_RELEASE);
+}
+
+/* Root of the sysfs and procfs files read for the cache topology
+ * returns: path prefix, "" for the system root
+ */
+static inline const char *get_sysfs_root(void)
+{
+#ifdef ALMEM_TUNABLES
+    if (user_config.sysfs_root != NULL)
+        return user_config.sysfs_root;
+#endif
+    return "";
+}
+
+/* L3 sharing mode the non-temporal thresholds are computed with
+ * returns: sharing mode
+ */
+static inline l3_sharing get_l3_sharing_cfg(void)
+{
+#ifdef ALMEM_TUNABLES
+    return user_config.l3_share;
+#else
+    return CCX_SHARE;
+#endif
+}
+
+/* Number of threads the L3 per CCX is shared with in the given mode
+ * returns: thread count
+ */
+static inline unsigned int get_l3_sharing_threads(cpu_info *zen_info, unsigned int threads_per_ccx,
+                                                  l3_sharing l3_share)
+{
+    unsigned int threads = threads_per_ccx;
+
+    if (l3_share == NO_SHARE)
+        return 1;
+
+    if (l3_share == AFFINITY_SHARE)
+    {
+        // a process confined to fewer CPUs than a CCX competes only with itself
+        unsigned int cpus = zen_info->zen_cache_budget.cpus;
+        if (cpus != 0 && cpus < threads)
+            threads = cpus;
+    }
+    return threads ? threads : 1;
+}
+
+/* Non-temporal moves threshold for the L3 per CCX budget and its sharing threads
+ * returns: threshold in Bytes
+ */
+static inline uint64_t compute_nt_start_threshold(cpu_info *zen_info, uint64_t l3_budget,
+                                                  unsigned int threads_per_ccx)
+{
+    uint64_t l3_share, nt_start_threshold;
+
+    l3_share = COMPUTE_L3_SHARE(l3_budget,
+                get_l3_sharing_threads(zen_info, threads_per_ccx, get_l3_sharing_cfg()));
+    // Zen5
+    if (zen_info->zen_uarch == ZEN5)
+        nt_start_threshold = COMPUTE_NT_THRESHOLD_ZEN5(l3_share);
+    // ZEN4 and earlier, other vendors (NT stores start from 3/4 of L3 cache)
+    else
+        nt_start_threshold = COMPUTE_NT_MOV_THRESHOLD(l3_share);
+    LOG_DEBUG("L3 share per thread: %lu\n", l3_share);
+
+    return CLAMP_NT_THRESHOLD(nt_start_threshold, zen_info->zen_cache_info.l2_per_core);
+}
+
+/* rep-stores stop threshold for the L3 per CCX budget
+ * returns: threshold in Bytes
+ */
+static inline uint64_t compute_repstore_stop_threshold(cpu_info *zen_info, uint64_t l3_budget)
+{
+    if (zen_info->zen_cpu_features.erms != ENABLED)
+        return 0;
+    return CLAMP_NT_THRESHOLD(l3_budget, zen_info->zen_cache_info.l2_per_core);
+}
 
 static inline void compute_sys_thresholds(cpu_info *zen_info)
 {
     get_cache_info(zen_info);
-    if (zen_info->zen_cpu_features.erms == ENABLED)
+    get_cache_budget(zen_info, get_sysfs_root());
+    if (zen_info->zen_cpu_features.erms == ENABLED && is_amd_vendor(zen_info->vendor))
     {
         zen_info->zen_thresholds.repmov_start_threshold = 2 * 1024;
         zen_info->zen_thresholds.repmov_stop_threshold = zen_info->zen_cache_info.l2_per_core;
         zen_info->zen_thresholds.repstore_start_threshold = zen_info->zen_cache_info.l2_per_core;
-        zen_info->zen_thresholds.repstore_stop_threshold = zen_info->zen_cache_info.l3_per_ccx;
+    }
+    // Other vendors: rep-movs from 2KB per XMM of vector width up to NT moves, rep-stores from 2KB
+    else if (zen_info->zen_cpu_features.erms == ENABLED)
+    {
+        uint64_t vec_bytes = (zen_info->zen_cpu_features.avx512 == ENABLED) ? ZMM_SZ :
+                             (zen_info->zen_cpu_features.avx2 == ENABLED) ? YMM_SZ : XMM_SZ;
+
+        if (zen_info->zen_cpu_features.fsrm == ENABLED)
+            vec_bytes = XMM_SZ;
+        zen_info->zen_thresholds.repmov_start_threshold = COMPUTE_REPMOV_START_TH(vec_bytes);
+        zen_info->zen_thresholds.repmov_stop_threshold = 0;
+        zen_info->zen_thresholds.repstore_start_threshold = 2 * 1024;
     } else
     {
         zen_info->zen_thresholds.repmov_start_threshold = 0;
         zen_info->zen_thresholds.repmov_stop_threshold = 0;
         zen_info->zen_thresholds.repstore_start_threshold = 0;
-        zen_info->zen_thresholds.repstore_stop_threshold = 0;
     }
-    // Zen5
-    if (zen_info->zen_cpu_features.movdiri == ENABLED)
-        zen_info->zen_thresholds.nt_start_threshold = COMPUTE_NT_THRESHOLD_ZEN5(zen_info->zen_cache_info.l3_per_ccx);
-    // ZEN4 and earlier (NT stores start from 3/4 of L3 cache)
-    else
-        zen_info->zen_thresholds.nt_start_threshold = COMPUTE_NT_MOV_THRESHOLD(zen_info->zen_cache_info.l3_per_ccx);
+    zen_info->zen_thresholds.repstore_stop_threshold = compute_repstore_stop_threshold(zen_info,
+                                                        zen_info->zen_cache_budget.l3_per_ccx);
+    zen_info->zen_thresholds.nt_start_threshold = compute_nt_start_threshold(zen_info,
+                                                    zen_info->zen_cache_budget.l3_per_ccx,
+                                                    zen_info->zen_thread_info.threads_per_ccx);
     zen_info->zen_thresholds.nt_stop_threshold = -1;
+    // rep-movs runs up to the NT moves on other vendors
+    if (!is_amd_vendor(zen_info->vendor) && zen_info->zen_cpu_features.erms == ENABLED)
+        zen_info->zen_thresholds.repmov_stop_threshold = zen_info->zen_thresholds.nt_start_threshold;
 }
 
-static inline void configure_thresholds()
+/* glibc tunables of the x86 string thresholds, honored for drop-in compatibility */
+typedef enum {
+    GLIBC_NT_TH,
+    GLIBC_REP_MOVSB_TH,
+    GLIBC_REP_STOSB_TH,
+    GLIBC_TH_COUNT
+} glibc_threshold;
+
+static const char * const glibc_threshold_tunables[GLIBC_TH_COUNT] = {
+    [GLIBC_NT_TH] = "glibc.cpu.x86_non_temporal_threshold",
+    [GLIBC_REP_MOVSB_TH] = "glibc.cpu.x86_rep_movsb_threshold",
+    [GLIBC_REP_STOSB_TH] = "glibc.cpu.x86_rep_stosb_threshold",
+};
+
+// glibc rejects the non-temporal thresholds below its minimum
+#define GLIBC_NT_THRESHOLD_MIN  0x4040
+
+/* Parses the x86 thresholds of GLIBC_TUNABLES: "name=value" pairs separated by ':',
+ * values in decimal, octal or hex as glibc reads them. Malformed values are ignored.
+ * returns: bitmask of the glibc_threshold values set
+ */
+static inline uint32_t parse_glibc_thresholds(uint64_t values[GLIBC_TH_COUNT])
 {
-    if (active_threshold_cfg == SYS_CFG)
+    const char *str = get_env_early("GLIBC_TUNABLES");
+    uint32_t set = 0;
+
+    while (str != NULL && *str != '\0')
+    {
+        const char *next = strchr(str, ':');
+        size_t len = next ? (size_t)(next - str) : strlen(str);
+
+        for (glibc_threshold idx = GLIBC_NT_TH; idx < GLIBC_TH_COUNT; idx++)
+        {
+            size_t name_len = strlen(glibc_threshold_tunables[idx]);
+            char *end;
+            uint64_t val;
+
+            if (len <= name_len + 1 || str[name_len] != '=' ||
+                strncmp(str, glibc_threshold_tunables[idx], name_len) != 0)
+                continue;
+            val = strtoull(str + name_len + 1, &end, 0);
+            if (end != str + len || str[name_len + 1] == '-')
+            {
+                LOG_WARN("Invalid GLIBC_TUNABLES value: %.*s\n", (int)len, str);
+                break;
+            }
+            values[idx] = val;
+            set |= 1U << idx;
+        }
+        str = next ? next + 1 : NULL;
+    }
+    return set;
+}
+
+/* Replaces the system thresholds with the x86 ones of GLIBC_TUNABLES, after the
+ * formulas, the core classes and the calibration, before the user thresholds:
+ *   glibc.cpu.x86_non_temporal_threshold -> non-temporal start of every core class
+ *   glibc.cpu.x86_rep_movsb_threshold    -> rep-movs start
+ *   glibc.cpu.x86_rep_stosb_threshold    -> rep-stores start
+ * The rep thresholds need ERMS, as in glibc.
+ * returns: void
+ */
+static inline void configure_glibc_thresholds(cpu_info *zen_info)
+{
+    thresholds *th = &(zen_info->zen_thresholds);
+    uint64_t values[GLIBC_TH_COUNT];
+    uint32_t set = parse_glibc_thresholds(values);
+
+    if (set & (1U << GLIBC_NT_TH))
+    {
+        if (values[GLIBC_NT_TH] < GLIBC_NT_THRESHOLD_MIN)
+            LOG_WARN("GLIBC_TUNABLES non-temporal threshold below %u ignored\n",
+                     GLIBC_NT_THRESHOLD_MIN);
+        else
+        {
+            th->nt_start_threshold = values[GLIBC_NT_TH];
+            for (unsigned int idx = 0; idx < CORE_CLASS_MAX; idx++)
+                __core_class_thresholds[idx].nt_start_threshold = values[GLIBC_NT_TH];
+            // rep-movs runs up to the NT moves on other vendors
+            if (!is_amd_vendor(zen_info->vendor) && zen_info->zen_cpu_features.erms == ENABLED)
+                th->repmov_stop_threshold = th->nt_start_threshold;
+        }
+    }
+    if (zen_info->zen_cpu_features.erms == ENABLED)
     {
-        __repmov_start_threshold = zen_info.zen_thresholds.repmov_start_threshold;
-        __repmov_stop_threshold = zen_info.zen_thresholds.repmov_stop_threshold;
-        __repstore_start_threshold = zen_info.zen_thresholds.repstore_start_threshold;
-        __repstore_stop_threshold = zen_info.zen_thresholds.repstore_stop_threshold;
-        __nt_start_threshold = zen_info.zen_thresholds.nt_start_threshold;
-        __nt_stop_threshold = zen_info.zen_thresholds.nt_stop_threshold;
+        if (set & (1U << GLIBC_REP_MOVSB_TH))
+            th->repmov_start_threshold = values[GLIBC_REP_MOVSB_TH];
+        if (set & (1U << GLIBC_REP_STOSB_TH))
+            th->repstore_start_threshold = values[GLIBC_REP_STOSB_TH];
     }
+    if (set)
+        LOG_INFO("GLIBC_TUNABLES: repmov_start: %lu, repstore_start: %lu, non_temporal: %lu\n",
+                 th->repmov_start_threshold, th->repstore_start_threshold,
+                 th->nt_start_threshold);
+}
 
 #ifdef ALMEM_TUNABLES
+/* Replaces the system thresholds of a function block with the user ones: its
+ * LIBMEM_<FUNC>_THRESHOLD, else LIBMEM_THRESHOLD. LIBMEM_THRESHOLD sets the
+ * non-temporal stores of memset, its rep-stores keep the system thresholds.
+ * returns: void
+ */
+static inline void configure_user_threshold_block(thresholds *th, threshold_block blk)
+{
+    const thresholds *usr = &user_config.user_threshold[blk];
 
-    else if (active_threshold_cfg == USR_CFG)
+    if (!(user_config.user_threshold_blocks & (1U << blk)))
+    {
+        if (!(user_config.user_threshold_blocks & (1U << TH_ALL)))
+            return;
+        usr = &user_config.user_threshold[TH_ALL];
+        if (blk != TH_MEMSET)
+        {
+            th->repmov_start_threshold = usr->repmov_start_threshold;
+            th->repmov_stop_threshold = usr->repmov_stop_threshold;
+        }
+    }
+    else if (blk == TH_MEMSET)
     {
-        __repmov_start_threshold = user_config.user_threshold.repmov_start_threshold;
-        __repmov_stop_threshold = user_config.user_threshold.repmov_stop_threshold;
-        __nt_start_threshold = user_config.user_threshold.nt_start_threshold;
-        __nt_stop_threshold = user_config.user_threshold.nt_stop_threshold;
+        th->repstore_start_threshold = usr->repstore_start_threshold;
+        th->repstore_stop_threshold = usr->repstore_stop_threshold;
     }
+    else
+    {
+        th->repmov_start_threshold = usr->repmov_start_threshold;
+        th->repmov_stop_threshold = usr->repmov_stop_threshold;
+    }
+    th->nt_start_threshold = usr->nt_start_threshold;
+    th->nt_stop_threshold = usr->nt_stop_threshold;
+}
 #endif
-    LOG_DEBUG("%s: repmov[%lu, %lu], repstore[%lu, %lu], non_temporal[%lu, %lu]\n",
-              active_threshold_cfg == SYS_CFG ? "System " : "User ", __repmov_start_threshold, __repmov_stop_threshold,
-              __repstore_start_threshold, __repstore_stop_threshold, __nt_start_threshold, __nt_stop_threshold);
+
+static inline void configure_thresholds()
+{
+    thresholds th[TH_ALL];
+
+    // memmove and the memset non-temporal stores default to the memcpy thresholds
+    for (threshold_block blk = TH_MEMCPY; blk < TH_ALL; blk++)
+        th[blk] = zen_info.zen_thresholds;
+
+#ifdef ALMEM_TUNABLES
+    if (active_threshold_cfg == USR_CFG)
+    {
+        for (threshold_block blk = TH_MEMCPY; blk < TH_ALL; blk++)
+            configure_user_threshold_block(&th[blk], blk);
+    }
+#endif
+
+    // published while other threads may run the kernels on reloads
+    __atomic_store_n(&__repmov_start_threshold,
+                        th[TH_MEMCPY].repmov_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repmov_stop_threshold,
+                        th[TH_MEMCPY].repmov_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_start_threshold,
+                        th[TH_MEMCPY].nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_stop_threshold,
+                        th[TH_MEMCPY].nt_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_repmov_start_threshold,
+                        th[TH_MEMMOVE].repmov_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_repmov_stop_threshold,
+                        th[TH_MEMMOVE].repmov_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_nt_start_threshold,
+                        th[TH_MEMMOVE].nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__memmove_nt_stop_threshold,
+                        th[TH_MEMMOVE].nt_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repstore_start_threshold,
+                        th[TH_MEMSET].repstore_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__repstore_stop_threshold,
+                        th[TH_MEMSET].repstore_stop_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_store_start_threshold,
+                        th[TH_MEMSET].nt_start_threshold, __ATOMIC_RELEASE);
+    __atomic_store_n(&__nt_store_stop_threshold,
+                        th[TH_MEMSET].nt_stop_threshold, __ATOMIC_RELEASE);
+
+    LOG_DEBUG("%s: memcpy: repmov[%lu, %lu], non_temporal[%lu, %lu]\n",
+              active_threshold_cfg == SYS_CFG ? "System " : "User ", __repmov_start_threshold,
+              __repmov_stop_threshold, __nt_start_threshold, __nt_stop_threshold);
+    LOG_DEBUG("memmove: repmov[%lu, %lu], non_temporal[%lu, %lu]\n",
+              __memmove_repmov_start_threshold, __memmove_repmov_stop_threshold,
+              __memmove_nt_start_threshold, __memmove_nt_stop_threshold);
+    LOG_DEBUG("memset: repstore[%lu, %lu], non_temporal[%lu, %lu]\n",
+              __repstore_start_threshold, __repstore_stop_threshold,
+              __nt_store_start_threshold, __nt_store_stop_threshold);
 }
@@ -0,0 +1,46 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stddef.h>
+#include "amd_memcpy.h"
+#include "amd_strlen.h"
+#include "amd_strcpy.h"
+
+/* Length scan with the zen3 kernel, then the copy including the NUL with the
+ * memcpy variant of the same operation type.
+ */
+#define STRCPY_AVX2_VARIANT(variant) \
+    char *__strcpy_avx2_##variant(char *dst, const char *src) \
+    { \
+        __memcpy_avx2_##variant(dst, src, __strlen_zen3(src) + 1); \
+        return dst; \
+    }
+
+STRCPY_AVX2_VARIANT(unaligned)
+STRCPY_AVX2_VARIANT(aligned)
+STRCPY_AVX2_VARIANT(aligned_load)
+STRCPY_AVX2_VARIANT(aligned_store)
+STRCPY_AVX2_VARIANT(nt)
+STRCPY_AVX2_VARIANT(nt_load)
+STRCPY_AVX2_VARIANT(nt_store)
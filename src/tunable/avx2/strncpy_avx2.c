@@ -0,0 +1,52 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stddef.h>
+#include "amd_memcpy.h"
+#include "amd_memset.h"
+#include "amd_strlen.h"
+#include "amd_strnlen.h"
+#include "amd_strncpy.h"
+
+/* Length scan with the zen3 kernel, then the copy with the memcpy variant and
+ * the zero-fill of the rest of dst with the memset variant of the same operation
+ * type: the nt/nt_store variants stream the padding of a huge dst.
+ */
+#define STRNCPY_AVX2_VARIANT(variant) \
+    char *__strncpy_avx2_##variant(char *dst, const char *src, size_t size) \
+    { \
+        size_t len = __strnlen_zen3(src, size); \
+        __memcpy_avx2_##variant(dst, src, len); \
+        if (len < size) \
+            __memset_avx2_##variant(dst + len, 0, size - len); \
+        return dst; \
+    }
+
+STRNCPY_AVX2_VARIANT(unaligned)
+STRNCPY_AVX2_VARIANT(aligned)
+STRNCPY_AVX2_VARIANT(aligned_load)
+STRNCPY_AVX2_VARIANT(aligned_store)
+STRNCPY_AVX2_VARIANT(nt)
+STRNCPY_AVX2_VARIANT(nt_load)
+STRNCPY_AVX2_VARIANT(nt_store)
@@ -0,0 +1,53 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "amd_strnlen.h"
+#include "../../base_impls/scan_avx512_impls.h"
+
+// Short strings: the zen4 kernel, tuned for the common case
+size_t __strnlen_avx512_unaligned(const char *str, size_t size)
+{
+    return __strnlen_zen4(str, size);
+}
+
+// Long-scan: 4x vector aligned loads
+size_t __strnlen_avx512_aligned(const char *str, size_t size)
+{
+    return __scan_avx512(str, size, 0, false, false);
+}
+
+// Long-scan with non-temporal prefetches ahead of the loads
+size_t __strnlen_avx512_nt(const char *str, size_t size)
+{
+    return __scan_avx512(str, size, 0, false, true);
+}
+
+// No stores: the store specific variants are the load variants
+size_t __strnlen_avx512_aligned_load(const char *str, size_t size) __attribute__((alias("__strnlen_avx512_aligned")));
+size_t __strnlen_avx512_aligned_store(const char *str, size_t size) __attribute__((alias("__strnlen_avx512_aligned")));
+size_t __strnlen_avx512_nt_load(const char *str, size_t size) __attribute__((alias("__strnlen_avx512_nt")));
+size_t __strnlen_avx512_nt_store(const char *str, size_t size) __attribute__((alias("__strnlen_avx512_nt")));
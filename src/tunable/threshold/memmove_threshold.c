@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-24 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -34,9 +34,9 @@ void * __memmove_threshold(void *dst, const void *src, size_t size)
 {
     LOG_INFO("\n");
 
-    if (size > __repmov_start_threshold && size < __repmov_stop_threshold)
+    if (size > __memmove_repmov_start_threshold && size < __memmove_repmov_stop_threshold)
         return __memmove_erms_b_aligned(dst, src, size);
-    else if (size > __nt_start_threshold && size < __nt_stop_threshold)
+    else if (size > __memmove_nt_start_threshold && size < __memmove_nt_stop_threshold)
     {
         if (zen_info.zen_cpu_features.avx512 == ENABLED)
             return __memmove_avx512_nt_store(dst, src, size);
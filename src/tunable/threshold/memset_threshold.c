@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-24 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2022-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -35,7 +35,7 @@ void * __memset_threshold(void *mem, int val, size_t size)
 	LOG_DEBUG("\n");
 	if (size > __repstore_start_threshold && size < __repstore_stop_threshold)
 		return __memset_erms_b_aligned(mem, val, size);
-	else if (size > __nt_start_threshold && size < __nt_stop_threshold)
+	else if (size > __nt_store_start_threshold && size < __nt_store_stop_threshold)
     {
         if (zen_info.zen_cpu_features.avx512 == ENABLED)
 		    return __memset_avx512_nt(mem, val, size);
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -32,6 +32,33 @@ HIDDEN_SYMBOL void * __attribute__((flatten)) __memmove_zen2(void *dst,
     return _memmove_avx2(dst, src, size);
 }
 
+#ifdef ALMEM_TUNABLES
+// Size class entries of the dispatching table
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memmove_zen2_small(void *dst,
+                             const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size < SC_SMALL_MAX_SZ);
+    return _memmove_avx2(dst, src, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memmove_zen2_medium(void *dst,
+                             const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_SMALL_MAX_SZ && size < SC_MEDIUM_MAX_SZ);
+    return _memmove_avx2(dst, src, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memmove_zen2_large(void *dst,
+                             const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_MEDIUM_MAX_SZ);
+    return _memmove_avx2(dst, src, size);
+}
+#endif
+
 #ifndef ALMEM_DYN_DISPATCH
 void *memmove(void *, const void *, size_t) __attribute__((weak,
                         alias("__memmove_zen2")));
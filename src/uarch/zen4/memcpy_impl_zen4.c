@@ -1,4 +1,4 @@
-/* Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2025-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -33,6 +33,13 @@
 
 extern cpu_info zen_info;
 
+// memmove reads the non-temporal threshold of its own block
+#ifdef MEMMOVE_ZEN4
+#define ALM_NT_START_THRESHOLD  __memmove_nt_start_threshold_cur
+#else
+#define ALM_NT_START_THRESHOLD  __nt_start_threshold_cur
+#endif
+
 #ifdef MEMMOVE_ZEN4
 static inline void *_memcpy_zen4_impl(void *dst, const void *src, size_t size)
 #else
@@ -160,7 +167,7 @@ static inline void *_memcpy_zen4_impl(void *__restrict dst, const void *__restri
             __aligned_load_and_store_8ymm_vec_loop(dst, src, size - 4 * ZMM_SZ, offset);
         }
         // 4-YMM registers with prefetch
-        else if (size < __nt_start_threshold)
+        else if (size < ALM_NT_START_THRESHOLD())
         {
             __aligned_load_and_store_4ymm_vec_loop_pftch(dst, src, size - 4 * ZMM_SZ, offset);
         }
@@ -173,7 +180,7 @@ static inline void *_memcpy_zen4_impl(void *__restrict dst, const void *__restri
     // Unaligned Load/Store addresses: force-align store address to ZMM size
     else
     {
-        if (size < __nt_start_threshold)
+        if (size < ALM_NT_START_THRESHOLD())
         {
             __unaligned_load_aligned_store_4zmm_vec_loop(dst, src, size - 4 * ZMM_SZ, offset);
         } else
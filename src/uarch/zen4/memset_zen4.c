@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -32,7 +32,7 @@
 
 extern cpu_info zen_info;
 
-HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4(void * mem, int  val, size_t size)
+static inline void *_memset_zen4_impl(void * mem, int val, size_t size)
 {
     __m512i z0;
     __m256i y0;
@@ -40,7 +40,6 @@ HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4(void * mem, int  val
     register void *ret asm("rax");
     ret = mem;
 
-    LOG_INFO("\n");
     z0 =  _mm512_set1_epi8(val);
 
     if (likely(size <= ZMM_SZ))
@@ -129,6 +128,36 @@ HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4(void * mem, int  val
     return ret;
 }
 
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4(void * mem, int  val, size_t size)
+{
+    LOG_INFO("\n");
+    return _memset_zen4_impl(mem, val, size);
+}
+
+#ifdef ALMEM_TUNABLES
+// Size class entries of the dispatching table
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4_small(void * mem, int  val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size < SC_SMALL_MAX_SZ);
+    return _memset_zen4_impl(mem, val, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4_medium(void * mem, int  val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_SMALL_MAX_SZ && size < SC_MEDIUM_MAX_SZ);
+    return _memset_zen4_impl(mem, val, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen4_large(void * mem, int  val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_MEDIUM_MAX_SZ);
+    return _memset_zen4_impl(mem, val, size);
+}
+#endif
+
 #ifndef ALMEM_DYN_DISPATCH
 void *memset(void *, int, size_t) __attribute__((weak,
                         alias("__memset_zen4")));
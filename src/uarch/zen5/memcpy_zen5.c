@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -32,6 +32,30 @@ HIDDEN_SYMBOL void *__memcpy_zen5(void *dst, const void *src, size_t size)
     return _memcpy_avx512_erms(dst, src, size);
 }
 
+#ifdef ALMEM_TUNABLES
+// Size class entries of the dispatching table
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memcpy_zen5_small(void *dst, const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size < SC_SMALL_MAX_SZ);
+    return _memcpy_avx512_erms(dst, src, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memcpy_zen5_medium(void *dst, const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_SMALL_MAX_SZ && size < SC_MEDIUM_MAX_SZ);
+    return _memcpy_avx512_erms(dst, src, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memcpy_zen5_large(void *dst, const void *src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_MEDIUM_MAX_SZ);
+    return _memcpy_avx512_erms(dst, src, size);
+}
+#endif
+
 #ifndef ALMEM_DYN_DISPATCH
 void *memcpy(void *, const void *, size_t) __attribute__((weak,
                         alias("__memcpy_zen5")));
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -35,6 +35,39 @@ HIDDEN_SYMBOL void * __attribute__((flatten)) __mempcpy_zen5(void *  __restrict
     return ret;
 }
 
+#ifdef ALMEM_TUNABLES
+// Size class entries of the dispatching table
+HIDDEN_SYMBOL void * __attribute__((flatten)) __mempcpy_zen5_small(void *  __restrict dst,
+                             const void *  __restrict src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size < SC_SMALL_MAX_SZ);
+    void *ret = dst + size;
+    _memcpy_avx512_erms(dst, src, size);
+    return ret;
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __mempcpy_zen5_medium(void *  __restrict dst,
+                             const void *  __restrict src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_SMALL_MAX_SZ && size < SC_MEDIUM_MAX_SZ);
+    void *ret = dst + size;
+    _memcpy_avx512_erms(dst, src, size);
+    return ret;
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __mempcpy_zen5_large(void *  __restrict dst,
+                             const void *  __restrict src, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_MEDIUM_MAX_SZ);
+    void *ret = dst + size;
+    _memcpy_avx512_erms(dst, src, size);
+    return ret;
+}
+#endif
+
 #ifndef ALMEM_DYN_DISPATCH
 void *mempcpy(void *, const void *, size_t) __attribute__((weak,
                         alias("__mempcpy_zen5")));
@@ -1,4 +1,4 @@
-/* Copyright (C) 2024-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2024-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -31,6 +31,30 @@ HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen5(void *mem, int val,
     return _memset_avx512_erms(mem, val, size);
 }
 
+#ifdef ALMEM_TUNABLES
+// Size class entries of the dispatching table
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen5_small(void *mem, int val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size < SC_SMALL_MAX_SZ);
+    return _memset_avx512_erms(mem, val, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen5_medium(void *mem, int val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_SMALL_MAX_SZ && size < SC_MEDIUM_MAX_SZ);
+    return _memset_avx512_erms(mem, val, size);
+}
+
+HIDDEN_SYMBOL void * __attribute__((flatten)) __memset_zen5_large(void *mem, int val, size_t size)
+{
+    LOG_INFO("\n");
+    ALM_ASSUME(size >= SC_MEDIUM_MAX_SZ);
+    return _memset_avx512_erms(mem, val, size);
+}
+#endif
+
 #ifndef ALMEM_DYN_DISPATCH
 void *memset(void *, int, size_t) __attribute__((weak,
                         alias("__memset_zen5")));
@@ -1,4 +1,4 @@
-/* Copyright (C) 2023-25 Advanced Micro Devices, Inc. All rights reserved.
+/* Copyright (C) 2023-26 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -33,6 +33,8 @@
 #include <math.h>
 #include <algorithm>
 #include <new> //for std::align_val_t
+#include <dlfcn.h> //for glibc_ prefixed functions
+#include <gnu/lib-names.h>
 
 #define MIN_PRINTABLE_ASCII     32
 #define MAX_PRINTABLE_ASCII     127
@@ -812,6 +814,36 @@ Strnlen_Data Strnlen_functionList[] = {
     {"strnlen", (size_t (*)(const char*, size_t)) strnlen},
 };
 
+//Rebinds the entry of 'func' to the glibc definition so that the same binary can
+//benchmark libmem (e.g. the __*_system fallback on non-AMD CPUs) against direct glibc calls.
+template <typename FuncList>
+void bindGlibcFunction(FuncList& list, const std::string& func, void* handle) {
+    for (auto &data : list) {
+        if (func == data.functionName) {
+            void *sym = dlsym(handle, data.functionName);
+            if (sym != NULL)
+                data.functionPtr = reinterpret_cast<decltype(data.functionPtr)>(sym);
+        }
+    }
+}
+
+void bindGlibcFunctions(const std::string& func) {
+    void *handle = dlopen(LIBC_SO, RTLD_LAZY | RTLD_NOLOAD);
+    if (handle == NULL) {
+        std::cerr << "Failed to open " << LIBC_SO << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    bindGlibcFunction(functionList, func, handle);
+    bindGlibcFunction(Misc_Mem_functionList, func, handle);
+    bindGlibcFunction(MiscStrfunctionList, func, handle);
+    bindGlibcFunction(strfunctionList, func, handle);
+    bindGlibcFunction(subfunctionList, func, handle);
+    bindGlibcFunction(str_n_functionList, func, handle);
+    bindGlibcFunction(Strlen_functionList, func, handle);
+    bindGlibcFunction(Strnlen_functionList, func, handle);
+    dlclose(handle);
+}
+
 enum class Parameters
 {
     function_name = 1,  // argv[1]
@@ -830,10 +862,17 @@ int main(int argc, char** argv) {
     srand(time(NULL));
     char Cache_Mode='h', alignment = 'd', spill = 'l', page = 'n', overlap = 'd';
     unsigned int size_start, size_end, iter = 0;
-    std::string func;
+    std::string func, func_prefix;
 
     func = argv[static_cast<int>(Parameters::function_name)];
 
+    //glibc_<func>: benchmark the glibc definition of <func>
+    if (func.compare(0, 6, "glibc_") == 0) {
+        func_prefix = "glibc_";
+        func = func.substr(6);
+        bindGlibcFunctions(func);
+    }
+
     if(argv[static_cast<int>(Parameters::function_mode)]!=NULL)
         Cache_Mode = *argv[static_cast<int>(Parameters::function_mode)];
 
@@ -857,7 +896,7 @@ int main(int argc, char** argv) {
     if(argv[static_cast<int>(Parameters::overlap)]!=NULL)
         overlap= *argv[static_cast<int>(Parameters::overlap)];
 
-    std::cout<<"FUNCTION: "<<func<<" MODE: "<<Cache_Mode<<std::endl;
+    std::cout<<"FUNCTION: "<<func_prefix<<func<<" MODE: "<<Cache_Mode<<std::endl;
     std::cout<<"SIZE: "<<size_start<<" "<<size_end<<std::endl;
 
     //Determine the cache mode
@@ -939,7 +978,7 @@ int main(int argc, char** argv) {
 
     //Register benchmark
     auto registerBenchmark = [&](auto benchmarkFunction, const std::string& suffix = "") {
-        std::string benchName = func + suffix + _Mode;
+        std::string benchName = func_prefix + func + suffix + _Mode;
         auto benchmark = benchmark::RegisterBenchmark(benchName.c_str(), benchmarkFunction)->RangeMultiplier(2);
         return (iter == 0) ? benchmark->Range(size_start, size_end) : benchmark->DenseRange(size_start, size_end, iter);
     };
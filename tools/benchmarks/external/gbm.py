@@ -1,5 +1,5 @@
 """
- Copyright (C) 2023-25 Advanced Micro Devices, Inc. All rights reserved.
+ Copyright (C) 2023-26 Advanced Micro Devices, Inc. All rights reserved.
 
  Redistribution and use in source and binary forms, with or without modification,
  are permitted provided that the following conditions are met:
@@ -89,6 +89,7 @@ class GBM(BaseBench):
             "-Lbenchmark/build/src",
             "-lbenchmark",
             "-lpthread",
+            "-ldl",
         ]
 
         # Passing AVX512_FEATURE_ENABLED for VEC_SZ computation
@@ -29,12 +29,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef LIBMEM_RUNTIME_INFO
+#include "../include/libmem_api.h"
+#endif
 
-#define ARCH_ZEN1 1
-#define ARCH_ZEN2 2
-#define ARCH_ZEN3 3
-#define ARCH_ZEN4 4
-#define ARCH_ZEN5 5
+//"arch" exits with the Zen generation: 1 for ZEN1 ... 5 for ZEN5
 #define ARCH_UNDF 255
 
 #define NON_AMD_CPU 0
@@ -56,36 +55,73 @@ static uint64_t get_cache_bytes(cpuid_registers *cpuid_regs, uint8_t cache_level
                        (((cpuid_regs->ebx & 0xfff) + 1) * (cpuid_regs->ecx + 1)));
 }
 
+#ifdef LIBMEM_RUNTIME_INFO
+/* Prints the runtime configuration of the linked libmem */
+static int print_runtime_info(void)
+{
+    libmem_runtime_info info;
+
+    if (libmem_get_runtime_info(&info) != 0)
+        return -1;
+
+    printf("uarch: %s\n", info.uarch);
+    printf("l1d_cache: %lu\n", info.l1d_size);
+    printf("l2_cache: %lu\n", info.l2_size);
+    printf("l3_cache: %lu\n", info.l3_size);
+    printf("repmov_start_threshold: %lu\n", info.repmov_start_threshold);
+    printf("repmov_stop_threshold: %lu\n", info.repmov_stop_threshold);
+    printf("repstore_start_threshold: %lu\n", info.repstore_start_threshold);
+    printf("repstore_stop_threshold: %lu\n", info.repstore_stop_threshold);
+    printf("nt_start_threshold: %lu\n", info.nt_start_threshold);
+    printf("nt_stop_threshold: %lu\n", info.nt_stop_threshold);
+    for (int idx = 0; idx < LIBMEM_FUNC_COUNT; idx++)
+        printf("%s: %s\n", info.funcs[idx].func, info.funcs[idx].variant);
+    return 0;
+}
+#endif
+
 int main(int argc, char **argv)
 {
     cpuid_registers cpuid_regs;
 
+#ifdef LIBMEM_RUNTIME_INFO
+    if (argc < 2)
+        return print_runtime_info();
+#else
     if (argc < 2)
         return -1;
+#endif
 
     const char *cmd = argv[1];
 
-    /* Architecture */
+#ifdef LIBMEM_RUNTIME_INFO
+    if (strcmp(cmd, "runtime_info") == 0)
+        return print_runtime_info();
+#endif
+
+    /* Architecture: family/model table, lowered to the exposed ISA */
     if (strcmp(cmd, "arch") == 0)
     {
+        uint32_t ebx7, ecx7, family;
+        microarch uarch;
+
         cpuid_regs.eax = 0x7;
         cpuid_regs.ecx = 0;
         __get_cpu_id(&cpuid_regs);
-        if (cpuid_regs.ebx & AVX512_MASK)
-        {
-            if (cpuid_regs.ecx & MOVDIRI_MASK)
-                return ARCH_ZEN5;
-            return ARCH_ZEN4;
-        } else if (cpuid_regs.ebx & AVX2_MASK)
-        {
-            if (cpuid_regs.ecx & VPCLMULQDQ_MASK)
-                return ARCH_ZEN3;
-            if (cpuid_regs.ecx & RDPID_MASK)
-                return ARCH_ZEN2;
-            if (cpuid_regs.ebx & RDSEED_MASK)
-                return ARCH_ZEN1;
-        }
-        return ARCH_UNDF;
+        ebx7 = cpuid_regs.ebx;
+        ecx7 = cpuid_regs.ecx;
+
+        cpuid_regs.eax = 0x1;
+        cpuid_regs.ecx = 0;
+        __get_cpu_id(&cpuid_regs);
+        family = CPUID_FAMILY(cpuid_regs.eax);
+        uarch = zen_uarch_from_model(family, CPUID_MODEL(cpuid_regs.eax));
+        if (uarch == UARCH_UNKNOWN && family > ZEN5_FAMILY)
+            uarch = ZEN5;
+        else if (uarch == UARCH_UNKNOWN)
+            uarch = zen_uarch_from_features(ebx7, ecx7);
+        uarch = zen_uarch_supported(uarch, ebx7, ecx7);
+        return (uarch == UARCH_UNKNOWN) ? ARCH_UNDF : (int)uarch;
     }
 
     if (strcmp(cmd, "vendor") == 0)
@@ -149,17 +185,23 @@ int main(int argc, char **argv)
     if (strcmp(cmd, "l3_cache") == 0)
         return (int) (get_cache_bytes(&cpuid_regs, 0x3) >> 20);
 
+    /* NT moves threshold in 512KB units */
     if (strcmp(cmd, "nt_threshold") == 0)
     {
+        uint64_t l2_bytes = get_cache_bytes(&cpuid_regs, 0x2);
         uint64_t l3_bytes = get_cache_bytes(&cpuid_regs, 0x3);
+        uint64_t l3_share = COMPUTE_L3_SHARE(l3_bytes, CACHE_SHARING_THREADS(cpuid_regs.eax));
+        uint64_t nt_bytes;
         cpuid_regs.eax = 0x7;
         cpuid_regs.ecx = 0;
         __get_cpu_id(&cpuid_regs);
-        /* Zen5: NT moves/stores start from L3 */
+        /* Zen5: NT moves start from the L3 share */
         if (cpuid_regs.ecx & MOVDIRI_MASK)
-            return (int) (COMPUTE_NT_THRESHOLD_ZEN5(l3_bytes) >> 20);
-        /* Pre-Zen5: NT moves start from 3/4 of L3 */
-        return (int) (COMPUTE_NT_MOV_THRESHOLD(l3_bytes) >> 20);
+            nt_bytes = COMPUTE_NT_THRESHOLD_ZEN5(l3_share);
+        /* Pre-Zen5: NT moves start from 3/4 of the L3 share */
+        else
+            nt_bytes = COMPUTE_NT_MOV_THRESHOLD(l3_share);
+        return (int) (CLAMP_NT_THRESHOLD(nt_bytes, l2_bytes) >> 19);
     }
 
     if (strcmp(cmd, "aligned_vec_cpy_threshold") == 0)
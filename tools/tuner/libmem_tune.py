@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+ Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+ 3. Neither the name of the copyright holder nor the names of its contributors
+    may be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+"""
+
+# libmem-tune: sweeps the tunable variants and the LIBMEM_THRESHOLD grid of a
+# tunables build on the local machine and emits the best LIBMEM_OPERATION or
+# LIBMEM_THRESHOLD setting, optionally weighted by a prof_libmem.py histogram.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+tune_funcs = ['memcpy', 'mempcpy', 'memmove', 'memset', 'memcmp']
+
+# Tunable variants and their LIBMEM_OPERATION setting
+variant_operations = {
+    'avx2_unaligned': 'avx2,b,b',
+    'avx2_aligned': 'avx2,y,y',
+    'avx2_aligned_load': 'avx2,y,b',
+    'avx2_aligned_store': 'avx2,b,y',
+    'avx2_nt': 'avx2,n,n',
+    'avx2_nt_load': 'avx2,n,b',
+    'avx2_nt_store': 'avx2,b,n',
+    'avx512_unaligned': 'avx512,b,b',
+    'avx512_aligned': 'avx512,y,y',
+    'avx512_aligned_load': 'avx512,y,b',
+    'avx512_aligned_store': 'avx512,b,y',
+    'avx512_nt': 'avx512,n,n',
+    'avx512_nt_load': 'avx512,n,b',
+    'avx512_nt_store': 'avx512,b,n',
+    'erms_b_aligned': 'erms,b,b',
+    'erms_w_aligned': 'erms,w,w',
+    'erms_d_aligned': 'erms,d,d',
+    'erms_q_aligned': 'erms,q,q',
+}
+
+# Variants that are correct for any alignment and length
+safe_variants = ['avx2_unaligned', 'avx2_nt_store', 'avx512_unaligned',
+                 'avx512_nt_store', 'erms_b_aligned']
+
+# LIBMEM_THRESHOLD grid: rep movs window and non-temporal start, -1 = never
+grid_repmov_start = [0, 1024, 2048, 4096]
+grid_repmov_stop = [0, 8192, 32768, 131072, 524288, 2097152]
+grid_nt_start = [262144, 524288, 1048576, 2097152, 4194304, 8388608,
+                 16777216, -1]
+
+# Sizes timed without a histogram: 8B to 32MB in powers of 2
+default_sizes = [1 << s for s in range(3, 26)]
+
+def parse_size(size_str):
+    """Parses a size with an optional K/M/G suffix"""
+    match = re.match(r'^(\d+)([KMG]?)B?$', size_str.strip(), re.IGNORECASE)
+    if not match:
+        raise argparse.ArgumentTypeError(f"Invalid size: {size_str}")
+    return int(match.group(1)) << {'': 0, 'K': 10, 'M': 20, 'G': 30}[match.group(2).upper()]
+
+def parse_size_list(list_str):
+    return [parse_size(s) for s in list_str.split(',') if s]
+
+def parse_histogram(path):
+    """
+    Reads the log2 size histograms of a prof_libmem.py log.
+
+    Returns:
+        dict: function -> {representative size: calls}
+    """
+    header = re.compile(r'^=+ (\w+) \((\d+) calls\) =+$')
+    bucket = re.compile(r'^\s*(\d+)\s*->\s*(\d+)\s*:\s*(\d+)')
+    hist = {}
+    func = None
+
+    with open(path) as log:
+        for line in log:
+            match = header.match(line.strip())
+            if match:
+                func = match.group(1)
+                continue
+            match = bucket.match(line)
+            if func is None or not match:
+                continue
+            low, high, calls = (int(v) for v in match.groups())
+            if calls == 0:
+                continue
+            # middle of the bucket; later reports of the same bucket accumulate
+            size = max(low, (low + high + 1) // 2)
+            hist.setdefault(func, {})
+            hist[func][size] = hist[func].get(size, 0) + calls
+
+    # prof_libmem.py reports memmove calls under memcpy
+    if 'memcpy' in hist:
+        hist.setdefault('memmove', hist['memcpy'])
+        hist.setdefault('mempcpy', hist['memcpy'])
+    return hist
+
+def threshold_grid():
+    """LIBMEM_THRESHOLD values of the sweep"""
+    grid = []
+    windows = [(0, 0)] + [(start, stop) for start in grid_repmov_start
+                          for stop in grid_repmov_stop if stop > start]
+    for start, stop in windows:
+        for nt_start in grid_nt_start:
+            grid.append(f"{start},{stop},{nt_start},-1")
+    return grid
+
+def run_bench(bench, func, sizes, configs, core):
+    """
+    Times the function for each config with the harness.
+
+    Returns:
+        dict: config -> {size: ns per call}
+    """
+    cmd = [bench, func, ','.join(str(s) for s in sizes)] + configs
+    if core is not None:
+        cmd = ['taskset', '-c', str(core)] + cmd
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+    if proc.returncode != 0:
+        print(proc.stderr, file=sys.stderr)
+        sys.exit(f"Error: {bench} failed for {func}")
+
+    result = {}
+    for line in proc.stdout.splitlines():
+        config, size, ns = line.rsplit(',', 2)
+        result.setdefault(config, {})[int(size)] = float(ns)
+    return result
+
+def config_cost(timings, weights, baseline):
+    """
+    Projected cost of a config: total time of the histogram calls, or the
+    mean time relative to the default config without a histogram.
+    """
+    if weights:
+        return sum(calls * timings[size] for size, calls in weights.items())
+    return sum(timings[size] / baseline[size] for size in timings) / len(timings)
+
+def config_env(config):
+    """Environment setting of a config"""
+    if config == 'default':
+        return ''
+    if config.startswith('threshold:'):
+        return 'LIBMEM_THRESHOLD=' + config[len('threshold:'):]
+    return 'LIBMEM_OPERATION=' + variant_operations[config]
+
+def gain(base, cost):
+    return (base / cost - 1) * 100 if cost else 0.0
+
+def main():
+    parser = argparse.ArgumentParser(
+        prog='libmem-tune',
+        description='Searches the tunable variants and thresholds of libmem for the '
+                    'fastest setting on this machine.')
+    parser.add_argument('-f', '--functions', default=','.join(tune_funcs),
+                        help=f"comma separated functions to tune (default: {','.join(tune_funcs)})")
+    parser.add_argument('-H', '--histogram',
+                        help='prof_libmem.py log whose size histograms weight the sizes')
+    parser.add_argument('-s', '--sizes', type=parse_size_list,
+                        help='comma separated sizes to time without a histogram, e.g. 64,4K,1M')
+    parser.add_argument('-a', '--aligned', action='store_true',
+                        help='also sweep the variants requiring 64B aligned buffers and '
+                             'length multiples of the rep movs operand')
+    parser.add_argument('-c', '--core', type=int,
+                        help='core to run the measurements on')
+    parser.add_argument('-b', '--bench',
+                        default=os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                             'libmem_tune_bench'),
+                        help='path of the libmem_tune_bench harness')
+    parser.add_argument('-o', '--output',
+                        help='file to write the best setting to, as KEY=VALUE lines')
+    args = parser.parse_args()
+
+    funcs = [f for f in args.functions.split(',') if f]
+    for func in funcs:
+        if func not in tune_funcs:
+            parser.error(f"unsupported function {func}, choose from {','.join(tune_funcs)}")
+
+    hist = parse_histogram(args.histogram) if args.histogram else {}
+    variants = list(variant_operations) if args.aligned else safe_variants
+    configs = ['default'] + variants + ['threshold:' + t for t in threshold_grid()]
+
+    # per function results: config -> projected cost
+    costs = {}
+    for func in funcs:
+        weights = hist.get(func)
+        if args.histogram and not weights:
+            print(f"{func}: no calls in the histogram, skipped")
+            continue
+        sizes = sorted(weights) if weights else (args.sizes or default_sizes)
+        print(f"{func}: timing {len(configs)} configs at {len(sizes)} sizes...", flush=True)
+        timings = run_bench(args.bench, func, sizes, configs, args.core)
+        if 'default' not in timings:
+            sys.exit(f"Error: no measurements for {func}")
+        costs[func] = {config: config_cost(timings[config], weights, timings['default'])
+                       for config in timings}
+
+    if not costs:
+        sys.exit("Error: nothing to tune")
+
+    # LIBMEM_OPERATION and LIBMEM_THRESHOLD apply to all the functions: the best
+    # setting minimizes the cost summed over the functions, relative to each
+    # function's default so that no function dominates without a histogram
+    common = set.intersection(*(set(c) for c in costs.values()))
+    if args.histogram:
+        total = lambda config: sum(c[config] for c in costs.values())
+    else:
+        total = lambda config: sum(c[config] / c['default'] for c in costs.values())
+    best = min(common, key=total)
+
+    print(f"\n{'Function':<10}{'Best config':<36}{'Gain':>8}{'Gain with common':>20}")
+    print('-' * 74)
+    for func, cost in costs.items():
+        func_best = min(cost, key=cost.get)
+        print(f"{func:<10}{config_env(func_best) or 'default':<36}"
+              f"{gain(cost['default'], cost[func_best]):>7.1f}%"
+              f"{gain(cost['default'], cost[best]):>19.1f}%")
+
+    env = config_env(best)
+    print(f"\nBest common setting: {env or 'default (no tunable beats the system configuration)'}")
+    print(f"Projected gain: {gain(total('default'), total(best)):.1f}%")
+
+    if args.output:
+        with open(args.output, 'w') as out:
+            out.write('# generated by libmem-tune\n')
+            for func, cost in costs.items():
+                out.write(f"# {func}: {gain(cost['default'], cost[best]):.1f}% projected gain\n")
+            if env:
+                out.write(env + '\n')
+        print(f"Setting written to {args.output}")
+
+if __name__ == '__main__':
+    main()
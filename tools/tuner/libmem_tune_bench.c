@@ -0,0 +1,248 @@
+/* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Timing harness of libmem-tune: measures a function of the linked libmem
+ * at a list of sizes, for each of the given dispatching configs.
+ *
+ *  usage: libmem_tune_bench <func> <size>[,<size>...] <config>...
+ *  config: default                         - as dispatched at load time
+ *          <variant>                       - tunable variant, e.g. avx512_nt_store
+ *          threshold:<rs>,<re>,<ns>,<ne>   - threshold variant with the
+ *                                            LIBMEM_THRESHOLD values
+ *
+ *  "default" has to precede the configs rebinding the function.
+ *  Prints one "<config>,<size>,<ns per call>" line per measurement.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "../../include/libmem_api.h"
+
+#define BENCH_BYTES     (16UL << 20)    // bytes moved per measurement
+#define BENCH_ITER_MIN  4
+#define BENCH_ITER_MAX  (1UL << 20)
+#define BENCH_REPS      3               // best of
+#define BENCH_SIZES_MAX 64
+#define BENCH_PAGE_SZ   4096
+
+typedef void *(*move_fn)(void *, const void *, size_t);
+typedef void *(*set_fn)(void *, int, size_t);
+typedef int (*cmp_fn)(const void *, const void *, size_t);
+
+typedef struct {
+    const char *name;
+    libmem_func func;
+} bench_func;
+
+static const bench_func bench_funcs[] =
+{
+    {"memcpy", LIBMEM_MEMCPY},
+    {"mempcpy", LIBMEM_MEMPCPY},
+    {"memmove", LIBMEM_MEMMOVE},
+    {"memset", LIBMEM_MEMSET},
+    {"memcmp", LIBMEM_MEMCMP},
+};
+
+// called through volatile pointers to keep the compiler from inlining the calls
+static move_fn volatile bench_memcpy = memcpy;
+static move_fn volatile bench_mempcpy = mempcpy;
+static move_fn volatile bench_memmove = memmove;
+static set_fn volatile bench_memset = memset;
+static cmp_fn volatile bench_memcmp = memcmp;
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000UL + (uint64_t) ts.tv_nsec;
+}
+
+/* Times the function at the size, best of BENCH_REPS runs
+ * returns: nanoseconds per call
+ */
+static double bench_run(libmem_func func, uint8_t *dst, uint8_t *src, size_t size)
+{
+    size_t iter = BENCH_BYTES / (size ? size : 1);
+    double best = 0;
+    int sink = 0;
+
+    if (iter < BENCH_ITER_MIN)
+        iter = BENCH_ITER_MIN;
+    if (iter > BENCH_ITER_MAX)
+        iter = BENCH_ITER_MAX;
+
+    for (int rep = 0; rep < BENCH_REPS; rep++)
+    {
+        uint64_t start = bench_now_ns();
+
+        for (size_t i = 0; i < iter; i++)
+        {
+            switch (func)
+            {
+                case LIBMEM_MEMCPY:
+                    bench_memcpy(dst, src, size);
+                    break;
+                case LIBMEM_MEMPCPY:
+                    bench_mempcpy(dst, src, size);
+                    break;
+                case LIBMEM_MEMMOVE:
+                    bench_memmove(dst, src, size);
+                    break;
+                case LIBMEM_MEMSET:
+                    bench_memset(dst, (int) i, size);
+                    break;
+                default:
+                    sink += bench_memcmp(dst, src, size);
+                    break;
+            }
+        }
+
+        double ns = (double) (bench_now_ns() - start) / (double) iter;
+        if (rep == 0 || ns < best)
+            best = ns;
+    }
+    // memcmp buffers are equal, keep the result alive all the same
+    if (sink)
+        fprintf(stderr, "warning: memcmp mismatch\n");
+    return best;
+}
+
+/* Binds the function to the config
+ * returns: 0 on success, -1 on invalid or unsupported config
+ */
+static int bench_configure(libmem_func func, const char *config)
+{
+    libmem_thresholds th;
+    libmem_runtime_info info;
+    unsigned long long val[4];
+    const char *str;
+    char *end;
+
+    if (strcmp(config, "default") == 0)
+        return 0;
+
+    if (strncmp(config, "threshold:", 10) != 0)
+        return libmem_set_variant(func, config);
+
+    // LIBMEM_THRESHOLD syntax: -1 stands for the maximum length
+    str = config + 10;
+    for (int i = 0; i < 4; i++)
+    {
+        errno = 0;
+        if (strncmp(str, "-1", 2) == 0)
+        {
+            val[i] = UINT64_MAX;
+            end = (char *) str + 2;
+        }
+        else
+            val[i] = strtoull(str, &end, 10);
+        if (errno || end == str || *end != (i < 3 ? ',' : '\0'))
+            return -1;
+        str = end + 1;
+    }
+    // LIBMEM_THRESHOLD keeps the system rep stores
+    if (libmem_get_runtime_info(&info) != 0)
+        return -1;
+    th.repmov_start_threshold = val[0];
+    th.repmov_stop_threshold = val[1];
+    th.repstore_start_threshold = info.repstore_start_threshold;
+    th.repstore_stop_threshold = info.repstore_stop_threshold;
+    th.nt_start_threshold = val[2];
+    th.nt_stop_threshold = val[3];
+
+    if (libmem_set_variant(func, "threshold") != 0)
+        return -1;
+    return libmem_set_thresholds(&th);
+}
+
+int main(int argc, char **argv)
+{
+    size_t sizes[BENCH_SIZES_MAX], size_cnt = 0, max_size = 0;
+    const bench_func *bf = NULL;
+    char *str, *end;
+    uint8_t *buf;
+
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: %s <func> <size>[,<size>...] <config>...\n", argv[0]);
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(bench_funcs) / sizeof(bench_funcs[0]); i++)
+        if (strcmp(argv[1], bench_funcs[i].name) == 0)
+            bf = &bench_funcs[i];
+    if (bf == NULL)
+    {
+        fprintf(stderr, "Error: unsupported function '%s'\n", argv[1]);
+        return 1;
+    }
+
+    for (str = argv[2]; *str && size_cnt < BENCH_SIZES_MAX; str = *end ? end + 1 : end)
+    {
+        sizes[size_cnt] = strtoull(str, &end, 10);
+        if (end == str || (*end != ',' && *end != '\0'))
+        {
+            fprintf(stderr, "Error: invalid size list '%s'\n", argv[2]);
+            return 1;
+        }
+        if (sizes[size_cnt] > max_size)
+            max_size = sizes[size_cnt];
+        size_cnt++;
+    }
+
+    // page aligned, hence 64B aligned, source and destination buffers
+    max_size = (max_size + BENCH_PAGE_SZ - 1) & ~(size_t)(BENCH_PAGE_SZ - 1);
+    buf = mmap(NULL, 2 * max_size + BENCH_PAGE_SZ, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+    {
+        perror("mmap");
+        return 1;
+    }
+    memset(buf, 0x5a, 2 * max_size + BENCH_PAGE_SZ);
+
+    for (int cfg = 3; cfg < argc; cfg++)
+    {
+        if (bench_configure(bf->func, argv[cfg]) != 0)
+        {
+            fprintf(stderr, "%s: unsupported config '%s'\n", bf->name, argv[cfg]);
+            continue;
+        }
+        for (size_t i = 0; i < size_cnt; i++)
+            printf("%s,%zu,%.3f\n", argv[cfg], sizes[i],
+                    bench_run(bf->func, buf + max_size + BENCH_PAGE_SZ, buf, sizes[i]));
+        fflush(stdout);
+    }
+
+    munmap(buf, 2 * max_size + BENCH_PAGE_SZ);
+    return 0;
+}